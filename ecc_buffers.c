@@ -1,21 +1,693 @@
+// For pthread_setaffinity_np
+#define _GNU_SOURCE
 #include "ecc_buffers.h"
+#include "rs_ec.h"
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
 
-int ecc_buffer_init(ecc_buffer_t *buffer, uint64_t size)
+// Chunks share this many locks, chunk c takes lock c % stripes
+#define ECC_BUFFER_LOCK_STRIPES 64
+
+// Chunks the scrubber does between looking at its budget and the clock
+#define ECC_BUFFER_SCRUB_BATCH 64
+
+// Rounds a size up so whatever comes after it stays aligned
+#define ECC_BUFFER_ROUND_UP(size) \
+    (((size) + ECC_BUFFER_ALIGN - 1) & ~(size_t)(ECC_BUFFER_ALIGN - 1))
+
+struct ecc_buffer {
+    // Bytes held and how many chunks they're split into
+    uint64_t size;
+    uint64_t chunk_count;
+    // Data bytes in the last chunk, 1 to ECC_BUFFER_DATA_SIZE
+    int tail_length;
+    // Codec for full chunks, and one for a shortened last chunk. The
+    // parity matrices in them do the encoding.
+    rs_codec_t codec;
+    rs_codec_t tail_codec;
+    // The data of every chunk back to back, so it reads as one run of 
+    // size bytes, and ECC_BUFFER_PARITY_SIZE parity bytes per chunk in a
+    // region of its own
+    uint8_t* data;
+    uint8_t* parity;
+    // Epoch each chunk was last checked or written in. A chunk that 
+    // matches the current epoch is known good and reads skip checking 
+    // it. Starting a new epoch makes every chunk get checked again.
+    uint32_t* verified;
+    uint32_t epoch;
+    // When each chunk went dirty in write-back mode, in microseconds. 0
+    // for chunks whose parity is up to date. Only read without the lock
+    // as a hint.
+    uint64_t* dirty_since;
+    uint64_t dirty_count;
+    int write_back;
+    // Updated with atomics since any thread can bump them
+    ecc_buffer_stats_t stats;
+    // Whoever holds a chunk's stripe owns its codeword and verified mark.
+    // Nobody holds more than one at a time except to wrap the epoch, and
+    // that takes them in order.
+    pthread_mutex_t locks[ECC_BUFFER_LOCK_STRIPES];
+    // The codecs have one set of decode scratch each
+    pthread_mutex_t decode_lock;
+    // Background scrubber
+    pthread_t scrubber;
+    int scrubbing;
+    int stop_scrubbing;
+    ecc_scrubber_config_t scrubber_config;
+    // Thread flushing old dirty chunks in write-back mode
+    pthread_t flusher;
+    int flushing;
+    int stop_flushing;
+    ecc_write_back_config_t write_back_config;
+};
+
+// Codec memory without an encoder table, the parity matrix is faster
+static size_t ecc_buffer_codec_size(int k)
+{
+    return ECC_BUFFER_ROUND_UP(rs_codec_memory_size(
+        k + ECC_BUFFER_PARITY_SIZE, k, 0));
+}
+
+size_t ecc_buffer_memory_size(uint64_t size)
+{
+    if(size == 0) {
+        return 0;
+    }
+    uint64_t chunk_count = (size + ECC_BUFFER_DATA_SIZE - 1) /
+        ECC_BUFFER_DATA_SIZE;
+    int tail_length = (int)(size - (chunk_count - 1) * ECC_BUFFER_DATA_SIZE);
+    return ECC_BUFFER_ROUND_UP(sizeof(ecc_buffer_t)) +
+        ecc_buffer_codec_size(ECC_BUFFER_DATA_SIZE) +
+        ecc_buffer_codec_size(tail_length) +
+        ECC_BUFFER_ROUND_UP((size_t)chunk_count * sizeof(uint32_t)) +
+        ECC_BUFFER_ROUND_UP((size_t)chunk_count * sizeof(uint64_t)) +
+        (size_t)chunk_count * ECC_BUFFER_PARITY_SIZE +
+        (size_t)size;
+}
+
+int ecc_buffer_init(ecc_buffer_t** buffer, void* memory, uint64_t size)
+{
+    if(size == 0 || ((uintptr_t)memory & (ECC_BUFFER_ALIGN - 1)) != 0) {
+        return -1;
+    }
+
+    ecc_buffer_t* result = (ecc_buffer_t*)memory;
+    result->size = size;
+    result->chunk_count = (size + ECC_BUFFER_DATA_SIZE - 1) /
+        ECC_BUFFER_DATA_SIZE;
+    result->tail_length = (int)(size -
+        (result->chunk_count - 1) * ECC_BUFFER_DATA_SIZE);
+
+    uint8_t* next = (uint8_t*)memory +
+        ECC_BUFFER_ROUND_UP(sizeof(ecc_buffer_t));
+    if(rs_codec_init(&result->codec, &gf8_field_default,
+        ECC_BUFFER_CODEWORD_SIZE, ECC_BUFFER_DATA_SIZE, 0, 1, next, 0) != 0) {
+        return -1;
+    }
+    next += ecc_buffer_codec_size(ECC_BUFFER_DATA_SIZE);
+    if(rs_codec_init(&result->tail_codec, &gf8_field_default,
+        result->tail_length + ECC_BUFFER_PARITY_SIZE, result->tail_length,
+        0, 1, next, 0) != 0) {
+        return -1;
+    }
+    next += ecc_buffer_codec_size(result->tail_length);
+
+    // Nothing has been checked yet
+    result->verified = (uint32_t*)next;
+    memset(result->verified, 0, 
+        (size_t)result->chunk_count * sizeof(uint32_t));
+    result->epoch = 1;
+    memset(&result->stats, 0, sizeof(result->stats));
+    for(int i = 0; i < ECC_BUFFER_LOCK_STRIPES; i++) {
+        pthread_mutex_init(&result->locks[i], 0);
+    }
+    pthread_mutex_init(&result->decode_lock, 0);
+    result->scrubbing = 0;
+    result->stop_scrubbing = 0;
+    next += ECC_BUFFER_ROUND_UP((size_t)result->chunk_count * 
+        sizeof(uint32_t));
+
+    // Starts out encoding every write
+    result->dirty_since = (uint64_t*)next;
+    memset(result->dirty_since, 0, 
+        (size_t)result->chunk_count * sizeof(uint64_t));
+    result->dirty_count = 0;
+    result->write_back = 0;
+    result->flushing = 0;
+    result->stop_flushing = 0;
+    next += ECC_BUFFER_ROUND_UP((size_t)result->chunk_count * 
+        sizeof(uint64_t));
+
+    // All zeroes is a codeword, so there's nothing to encode yet. The
+    // parity is a multiple of the alignment, so the data is aligned too.
+    result->parity = next;
+    memset(result->parity, 0, 
+        (size_t)result->chunk_count * ECC_BUFFER_PARITY_SIZE);
+    next += (size_t)result->chunk_count * ECC_BUFFER_PARITY_SIZE;
+    result->data = next;
+    memset(result->data, 0, (size_t)size);
+
+    *buffer = result;
+    return 0;
+}
+
+int ecc_buffer_free(ecc_buffer_t* buffer)
+{
+    if(!buffer) {
+        return -1;
+    }
+    if(buffer->scrubbing) {
+        ecc_buffer_scrubber_stop(buffer);
+    }
+    if(buffer->write_back) {
+        ecc_buffer_write_back_stop(buffer);
+    }
+    for(int i = 0; i < ECC_BUFFER_LOCK_STRIPES; i++) {
+        pthread_mutex_destroy(&buffer->locks[i]);
+    }
+    pthread_mutex_destroy(&buffer->decode_lock);
+    buffer->size = 0;
+    buffer->chunk_count = 0;
+    buffer->data = 0;
+    buffer->parity = 0;
+    return 0;
+}
+
+// Codec for a chunk, the last one can be shortened
+static rs_codec_t* ecc_buffer_codec(ecc_buffer_t* buffer, uint64_t chunk)
+{
+    return (chunk == buffer->chunk_count - 1) ? &buffer->tail_codec :
+        &buffer->codec;
+}
+
+// Finds a chunk's data and parity, and returns how much data it has
+static int ecc_buffer_locate(ecc_buffer_t* buffer, uint64_t chunk,
+    uint8_t** data, uint8_t** parity)
+{
+    *data = buffer->data + (size_t)chunk * ECC_BUFFER_DATA_SIZE;
+    *parity = buffer->parity + (size_t)chunk * ECC_BUFFER_PARITY_SIZE;
+    return ecc_buffer_codec(buffer, chunk)->k;
+}
+
+static void ecc_buffer_lock(ecc_buffer_t* buffer, uint64_t chunk)
+{
+    pthread_mutex_lock(&buffer->locks[chunk % ECC_BUFFER_LOCK_STRIPES]);
+}
+
+static void ecc_buffer_unlock(ecc_buffer_t* buffer, uint64_t chunk)
+{
+    pthread_mutex_unlock(&buffer->locks[chunk % ECC_BUFFER_LOCK_STRIPES]);
+}
+
+static void ecc_buffer_count(uint64_t* counter, uint64_t amount)
+{
+    __atomic_fetch_add(counter, amount, __ATOMIC_RELAXED);
+}
+
+// Moves to the next epoch unless that would wrap. 0 is what a chunk 
+// that was never checked has, so the epoch can't land on it, not even 
+// for a moment. Returns 1 if it moved, 0 if it has to wrap.
+static int ecc_buffer_next_epoch(ecc_buffer_t* buffer)
+{
+    uint32_t epoch = __atomic_load_n(&buffer->epoch, __ATOMIC_RELAXED);
+    while(epoch != UINT32_MAX) {
+        if(__atomic_compare_exchange_n(&buffer->epoch, &epoch, epoch + 1, 
+            0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int ecc_buffer_new_epoch(ecc_buffer_t* buffer)
 {
+    if(ecc_buffer_next_epoch(buffer)) {
+        return 0;
+    }
 
+    // Wrapping clears every mark so an old one can't match again. All 
+    // the stripes are taken before anything changes so nobody looks at 
+    // the marks or the epoch halfway through. Someone else may have 
+    // wrapped it already while this waited for them.
+    for(int i = 0; i < ECC_BUFFER_LOCK_STRIPES; i++) {
+        pthread_mutex_lock(&buffer->locks[i]);
+    }
+    if(!ecc_buffer_next_epoch(buffer)) {
+        memset(buffer->verified, 0, 
+            (size_t)buffer->chunk_count * sizeof(uint32_t));
+        __atomic_store_n(&buffer->epoch, 1, __ATOMIC_RELAXED);
+    }
+    for(int i = ECC_BUFFER_LOCK_STRIPES - 1; i >= 0; i--) {
+        pthread_mutex_unlock(&buffer->locks[i]);
+    }
+    return 0;
 }
 
-int ecc_buffer_free(ecc_buffer_t *buffer)
+int ecc_buffer_stats(const ecc_buffer_t* buffer, ecc_buffer_stats_t* stats)
 {
+    const ecc_buffer_stats_t* totals = &buffer->stats;
+    stats->chunks_checked = __atomic_load_n(&totals->chunks_checked, 
+        __ATOMIC_RELAXED);
+    stats->chunks_corrected = __atomic_load_n(&totals->chunks_corrected, 
+        __ATOMIC_RELAXED);
+    stats->symbols_corrected = __atomic_load_n(&totals->symbols_corrected, 
+        __ATOMIC_RELAXED);
+    stats->uncorrectable = __atomic_load_n(&totals->uncorrectable, 
+        __ATOMIC_RELAXED);
+    stats->scrubbed_chunks = __atomic_load_n(&totals->scrubbed_chunks, 
+        __ATOMIC_RELAXED);
+    stats->scrub_passes = __atomic_load_n(&totals->scrub_passes, 
+        __ATOMIC_RELAXED);
+    stats->chunks_flushed = __atomic_load_n(&totals->chunks_flushed, 
+        __ATOMIC_RELAXED);
+    return 0;
+}
 
+int ecc_buffer_chunk(ecc_buffer_t* buffer, uint64_t chunk,
+    uint8_t** data, uint8_t** parity)
+{
+    if(chunk >= buffer->chunk_count) {
+        return -1;
+    }
+    return ecc_buffer_locate(buffer, chunk, data, parity);
 }
 
-int ecc_buffer_set(ecc_buffer_t *buffer, data_t *data, uint64_t size)
+// Microseconds since some fixed point, for pacing the scrubber and 
+// aging dirty chunks. Never 0 so it can mark a dirty chunk.
+static uint64_t ecc_buffer_now_us(void)
 {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000 
+        + 1;
+}
 
+// Marks a locked chunk as having data newer than its parity
+static void ecc_buffer_mark_dirty(ecc_buffer_t* buffer, uint64_t chunk)
+{
+    if(buffer->dirty_since[chunk] == 0) {
+        __atomic_store_n(&buffer->dirty_since[chunk], ecc_buffer_now_us(),
+            __ATOMIC_RELAXED);
+        ecc_buffer_count(&buffer->dirty_count, 1);
+    }
 }
 
-int ecc_buffer_get(ecc_buffer_t *buffer, data_t *data, uint64_t size)
+// Encodes a locked chunk's parity if it's dirty. Having just been 
+// encoded it's as good as checked.
+static void ecc_buffer_flush_chunk(ecc_buffer_t* buffer, uint64_t chunk)
 {
+    if(buffer->dirty_since[chunk] == 0) {
+        return;
+    }
+    uint8_t* data;
+    uint8_t* parity;
+    ecc_buffer_locate(buffer, chunk, &data, &parity);
+    rs_codec_t* codec = ecc_buffer_codec(buffer, chunk);
+    rs_parity_matrix_encode_parity(&codec->parity_matrix, parity,
+        data, codec->k);
+    __atomic_store_n(&buffer->dirty_since[chunk], 0, __ATOMIC_RELAXED);
+    __atomic_fetch_sub(&buffer->dirty_count, 1, __ATOMIC_RELAXED);
+    buffer->verified[chunk] = __atomic_load_n(&buffer->epoch, 
+        __ATOMIC_RELAXED);
+    ecc_buffer_count(&buffer->stats.chunks_flushed, 1);
+}
 
-}
\ No newline at end of file
+// Checks a chunk and corrects it in place if it needs it, unless it's 
+// already been checked this epoch and force isn't set. A clean chunk is
+// one parity matrix pass and a compare, which is all most chunks ever 
+// need. The chunk has to be locked.
+// Returns the number of symbols corrected or -1.
+static int ecc_buffer_check_chunk(ecc_buffer_t* buffer, uint64_t chunk, 
+    int force)
+{
+    // A dirty chunk's parity is stale, there's nothing to check it with
+    if(buffer->dirty_since[chunk] != 0) {
+        ecc_buffer_flush_chunk(buffer, chunk);
+        return 0;
+    }
+
+    uint32_t epoch = __atomic_load_n(&buffer->epoch, __ATOMIC_RELAXED);
+    if(!force && buffer->verified[chunk] == epoch) {
+        return 0;
+    }
+
+    uint8_t* data;
+    uint8_t* parity;
+    ecc_buffer_locate(buffer, chunk, &data, &parity);
+    rs_codec_t* codec = ecc_buffer_codec(buffer, chunk);
+    ecc_buffer_count(&buffer->stats.chunks_checked, 1);
+
+    uint8_t expected[ECC_BUFFER_PARITY_SIZE];
+    rs_parity_matrix_encode_parity(&codec->parity_matrix, expected,
+        data, codec->k);
+    int corrected = 0;
+    if(memcmp(expected, parity, ECC_BUFFER_PARITY_SIZE) != 0) {
+        pthread_mutex_lock(&buffer->decode_lock);
+        corrected = rs_codec_decode(codec, data, parity);
+        pthread_mutex_unlock(&buffer->decode_lock);
+        if(corrected < 0) {
+            ecc_buffer_count(&buffer->stats.uncorrectable, 1);
+            return -1;
+        }
+        ecc_buffer_count(&buffer->stats.chunks_corrected, 1);
+        ecc_buffer_count(&buffer->stats.symbols_corrected, corrected);
+    }
+    buffer->verified[chunk] = epoch;
+    return corrected;
+}
+
+int ecc_buffer_scrub(ecc_buffer_t* buffer, uint64_t first_chunk, 
+    uint64_t chunk_count)
+{
+    if(chunk_count > buffer->chunk_count || 
+        first_chunk > buffer->chunk_count - chunk_count) {
+        return -1;
+    }
+
+    int result = 0;
+    for(uint64_t chunk = first_chunk; chunk < first_chunk + chunk_count; 
+        chunk++) {
+        ecc_buffer_lock(buffer, chunk);
+        if(ecc_buffer_check_chunk(buffer, chunk, 1) < 0) {
+            result = -1;
+        }
+        ecc_buffer_unlock(buffer, chunk);
+    }
+    ecc_buffer_count(&buffer->stats.scrubbed_chunks, chunk_count);
+    return result;
+}
+
+// Sleeps for some microseconds, in naps of up to 10 ms so a stop 
+// request is noticed quickly
+static void ecc_buffer_sleep(const int* stop, uint64_t microseconds)
+{
+    while(microseconds > 0 && !__atomic_load_n(stop, __ATOMIC_ACQUIRE)) {
+        uint64_t nap = (microseconds > 10000) ? 10000 : microseconds;
+        struct timespec sleep_time;
+        sleep_time.tv_sec = 0;
+        sleep_time.tv_nsec = (long)nap * 1000;
+        nanosleep(&sleep_time, 0);
+        microseconds -= nap;
+    }
+}
+
+// Pins a thread to a CPU. It still runs if that fails, just anywhere.
+static void ecc_buffer_pin(pthread_t thread, int cpu)
+{
+#ifdef __linux__
+    if(cpu >= 0) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(cpu, &cpus);
+        pthread_setaffinity_np(thread, sizeof(cpus), &cpus);
+    }
+#else
+    (void)thread;
+    (void)cpu;
+#endif
+}
+
+static void* ecc_buffer_scrubber_run(void* argument)
+{
+    ecc_buffer_t* buffer = (ecc_buffer_t*)argument;
+    uint64_t bytes_per_second = buffer->scrubber_config.bytes_per_second;
+
+    // Goes a batch at a time and sleeps off however far ahead of the 
+    // budget that put it. All in whole bytes and microseconds.
+    uint64_t start = ecc_buffer_now_us();
+    uint64_t bytes_done = 0;
+    uint64_t position = 0;
+    while(!__atomic_load_n(&buffer->stop_scrubbing, __ATOMIC_ACQUIRE)) {
+        uint64_t count = buffer->chunk_count - position;
+        if(count > ECC_BUFFER_SCRUB_BATCH) {
+            count = ECC_BUFFER_SCRUB_BATCH;
+        }
+        ecc_buffer_scrub(buffer, position, count);
+        bytes_done += count * ECC_BUFFER_DATA_SIZE;
+        position += count;
+        if(position == buffer->chunk_count) {
+            position = 0;
+            ecc_buffer_count(&buffer->stats.scrub_passes, 1);
+        }
+
+        if(bytes_per_second == 0) {
+            continue;
+        }
+        // When the budget says bytes_done should be done by. Whole 
+        // seconds and the rest apart, so it can't overflow in any 
+        // realistic run.
+        uint64_t due = bytes_done / bytes_per_second * 1000000 + 
+            bytes_done % bytes_per_second * 1000000 / bytes_per_second;
+        uint64_t elapsed = ecc_buffer_now_us() - start;
+        if(due > elapsed) {
+            ecc_buffer_sleep(&buffer->stop_scrubbing, due - elapsed);
+        }
+    }
+    return 0;
+}
+
+int ecc_buffer_scrubber_start(ecc_buffer_t* buffer, 
+    const ecc_scrubber_config_t* config)
+{
+    if(buffer->scrubbing) {
+        return -1;
+    }
+    buffer->scrubber_config = *config;
+    buffer->stop_scrubbing = 0;
+    if(pthread_create(&buffer->scrubber, 0, ecc_buffer_scrubber_run, 
+        buffer) != 0) {
+        return -1;
+    }
+    ecc_buffer_pin(buffer->scrubber, config->cpu);
+    buffer->scrubbing = 1;
+    return 0;
+}
+
+int ecc_buffer_scrubber_stop(ecc_buffer_t* buffer)
+{
+    if(!buffer->scrubbing) {
+        return -1;
+    }
+    __atomic_store_n(&buffer->stop_scrubbing, 1, __ATOMIC_RELEASE);
+    pthread_join(buffer->scrubber, 0);
+    buffer->scrubbing = 0;
+    return 0;
+}
+
+int ecc_buffer_flush(ecc_buffer_t* buffer)
+{
+    // A write marks its chunk dirty and counts it before letting go of 
+    // the stripe, so once every stripe has been through here each write
+    // that got in first is counted. Whether a chunk is dirty is only 
+    // trusted under its lock.
+    for(int i = 0; i < ECC_BUFFER_LOCK_STRIPES; i++) {
+        pthread_mutex_lock(&buffer->locks[i]);
+        pthread_mutex_unlock(&buffer->locks[i]);
+    }
+    for(uint64_t chunk = 0; chunk < buffer->chunk_count && 
+        __atomic_load_n(&buffer->dirty_count, __ATOMIC_RELAXED) != 0; 
+        chunk++) {
+        ecc_buffer_lock(buffer, chunk);
+        ecc_buffer_flush_chunk(buffer, chunk);
+        ecc_buffer_unlock(buffer, chunk);
+    }
+    return 0;
+}
+
+static void* ecc_buffer_flusher_run(void* argument)
+{
+    ecc_buffer_t* buffer = (ecc_buffer_t*)argument;
+    uint64_t max_dirty_us = buffer->write_back_config.max_dirty_us;
+
+    // Wakes up four times per max age and flushes whatever has been 
+    // dirty for half of it. That keeps every chunk under the max while
+    // leaving the ones still being written alone for a while, so they 
+    // get encoded once for a whole run of writes.
+    while(!__atomic_load_n(&buffer->stop_flushing, __ATOMIC_ACQUIRE)) {
+        ecc_buffer_sleep(&buffer->stop_flushing, max_dirty_us / 4);
+        if(__atomic_load_n(&buffer->dirty_count, __ATOMIC_RELAXED) == 0) {
+            continue;
+        }
+        uint64_t now = ecc_buffer_now_us();
+        for(uint64_t chunk = 0; chunk < buffer->chunk_count; chunk++) {
+            uint64_t since = __atomic_load_n(&buffer->dirty_since[chunk], 
+                __ATOMIC_RELAXED);
+            // A chunk that went dirty after now was taken is as young as
+            // they get
+            if(since != 0 && since <= now && 
+                now - since >= max_dirty_us / 2) {
+                ecc_buffer_lock(buffer, chunk);
+                ecc_buffer_flush_chunk(buffer, chunk);
+                ecc_buffer_unlock(buffer, chunk);
+            }
+        }
+    }
+    return 0;
+}
+
+int ecc_buffer_write_back_start(ecc_buffer_t* buffer, 
+    const ecc_write_back_config_t* config)
+{
+    // The thread wakes up every max_dirty_us / 4, which has to be at 
+    // least a microsecond or it never sleeps at all
+    if(buffer->write_back || 
+        (config->max_dirty_us > 0 && config->max_dirty_us < 4)) {
+        return -1;
+    }
+    buffer->write_back_config = *config;
+    if(config->max_dirty_us > 0) {
+        buffer->stop_flushing = 0;
+        if(pthread_create(&buffer->flusher, 0, ecc_buffer_flusher_run, 
+            buffer) != 0) {
+            return -1;
+        }
+        ecc_buffer_pin(buffer->flusher, config->cpu);
+        buffer->flushing = 1;
+    }
+    __atomic_store_n(&buffer->write_back, 1, __ATOMIC_RELEASE);
+    return 0;
+}
+
+int ecc_buffer_write_back_stop(ecc_buffer_t* buffer)
+{
+    if(!buffer->write_back) {
+        return -1;
+    }
+    // Writes check the mode under their chunk's stripe. The ones that 
+    // still saw write-back mode are waited out by the flush going 
+    // through every stripe, and the ones after it see it's off, so 
+    // nothing is left dirty once the flush is done.
+    __atomic_store_n(&buffer->write_back, 0, __ATOMIC_RELEASE);
+    if(buffer->flushing) {
+        __atomic_store_n(&buffer->stop_flushing, 1, __ATOMIC_RELEASE);
+        pthread_join(buffer->flusher, 0);
+        buffer->flushing = 0;
+    }
+    return ecc_buffer_flush(buffer);
+}
+
+// Checks that [offset, offset + size) is inside the buffer without
+// overflowing
+static int ecc_buffer_check_range(const ecc_buffer_t* buffer,
+    uint64_t offset, uint64_t size)
+{
+    if(size > buffer->size || offset > buffer->size - size) {
+        return -1;
+    }
+    return 0;
+}
+
+int ecc_buffer_set(ecc_buffer_t* buffer, uint64_t offset,
+    const data_t* data, uint64_t size)
+{
+    if(ecc_buffer_check_range(buffer, offset, size) != 0) {
+        return -1;
+    }
+
+    while(size > 0) {
+        uint64_t chunk = offset / ECC_BUFFER_DATA_SIZE;
+        int start = (int)(offset % ECC_BUFFER_DATA_SIZE);
+        uint8_t* chunk_data;
+        uint8_t* parity;
+        int k = ecc_buffer_locate(buffer, chunk, &chunk_data, &parity);
+        int length = k - start;
+        if((uint64_t)length > size) {
+            length = (int)size;
+        }
+
+        rs_codec_t* codec = ecc_buffer_codec(buffer, chunk);
+        ecc_buffer_lock(buffer, chunk);
+        int write_back = __atomic_load_n(&buffer->write_back, 
+            __ATOMIC_ACQUIRE);
+        if(write_back && (length == k || buffer->dirty_since[chunk] != 0)) {
+            // Nothing to check or encode until it's flushed
+            memcpy(chunk_data + start, data, length);
+            ecc_buffer_mark_dirty(buffer, chunk);
+        } else if(length == k) {
+            // Whole chunk, the old parity doesn't matter. Having just 
+            // been encoded it's as good as checked.
+            memcpy(chunk_data, data, length);
+            rs_parity_matrix_encode_parity(&codec->parity_matrix, parity,
+                chunk_data, k);
+            buffer->verified[chunk] = __atomic_load_n(&buffer->epoch, 
+                __ATOMIC_RELAXED);
+        } else {
+            // Part of a chunk. The parity only moves by the parity of the
+            // change, once the rest of the chunk is known to be good.
+            if(ecc_buffer_check_chunk(buffer, chunk, 0) < 0) {
+                ecc_buffer_unlock(buffer, chunk);
+                return -1;
+            }
+            if(write_back) {
+                memcpy(chunk_data + start, data, length);
+                ecc_buffer_mark_dirty(buffer, chunk);
+            } else {
+                rs_update_parity(codec, parity, start, chunk_data + start,
+                    data, length);
+                memcpy(chunk_data + start, data, length);
+            }
+        }
+        ecc_buffer_unlock(buffer, chunk);
+
+        offset += length;
+        data += length;
+        size -= length;
+    }
+    return 0;
+}
+
+int ecc_buffer_get(ecc_buffer_t* buffer, uint64_t offset,
+    data_t* data, uint64_t size)
+{
+    if(ecc_buffer_check_range(buffer, offset, size) != 0) {
+        return -1;
+    }
+
+    while(size > 0) {
+        uint64_t chunk = offset / ECC_BUFFER_DATA_SIZE;
+        int start = (int)(offset % ECC_BUFFER_DATA_SIZE);
+        uint8_t* chunk_data;
+        uint8_t* parity;
+        int k = ecc_buffer_locate(buffer, chunk, &chunk_data, &parity);
+        int length = k - start;
+        if((uint64_t)length > size) {
+            length = (int)size;
+        }
+
+        ecc_buffer_lock(buffer, chunk);
+        if(ecc_buffer_check_chunk(buffer, chunk, 0) < 0) {
+            ecc_buffer_unlock(buffer, chunk);
+            return -1;
+        }
+        memcpy(data, chunk_data + start, length);
+        ecc_buffer_unlock(buffer, chunk);
+
+        offset += length;
+        data += length;
+        size -= length;
+    }
+    return 0;
+}
+
+const data_t* ecc_buffer_view(ecc_buffer_t* buffer, uint64_t offset, 
+    uint64_t size)
+{
+    if(ecc_buffer_check_range(buffer, offset, size) != 0) {
+        return 0;
+    }
+
+    // Same checks as a read, minus the copy
+    uint64_t end = offset + size;
+    for(uint64_t chunk = offset / ECC_BUFFER_DATA_SIZE; 
+        chunk * ECC_BUFFER_DATA_SIZE < end; chunk++) {
+        ecc_buffer_lock(buffer, chunk);
+        int result = ecc_buffer_check_chunk(buffer, chunk, 0);
+        ecc_buffer_unlock(buffer, chunk);
+        if(result < 0) {
+            return 0;
+        }
+    }
+    return buffer->data + offset;
+}
@@ -6,17 +6,233 @@
 #include <linux/types.h>
 #else
 #include <stdint.h>
+#include <stddef.h>
 #endif
 
-// Unknown. Replace with something valid / meaningful.
-typedef uint8_t ecc_buffer_t;
+// Every chunk of the buffer is its own RS(255, 223) codeword. The last
+// one is shortened to whatever is left. The data of all the chunks is 
+// kept in one contiguous run and the parity separately, so the data can
+// be used in place.
+#define ECC_BUFFER_DATA_SIZE 223
+#define ECC_BUFFER_PARITY_SIZE 32
+#define ECC_BUFFER_CODEWORD_SIZE \
+    (ECC_BUFFER_DATA_SIZE + ECC_BUFFER_PARITY_SIZE)
+
+// The memory handed to ecc_buffer_init has to be aligned to this
+#define ECC_BUFFER_ALIGN 16
+
+// Protected buffer. What's in it is private to ecc_buffers.c. Reads,
+// writes and the scrubber lock each chunk while they work on it, so 
+// they can come from any number of threads. A write that spans several
+// chunks isn't atomic as a whole though.
+typedef struct ecc_buffer ecc_buffer_t;
 
-// Probably should be an opaque type.
 typedef uint8_t data_t;
 
-int ecc_buffer_init(ecc_buffer_t *buffer, uint64_t size);
-int ecc_buffer_free(ecc_buffer_t *buffer);
-int ecc_buffer_set(ecc_buffer_t *buffer, data_t *data, uint64_t size);
-int ecc_buffer_get(ecc_buffer_t *buffer, data_t *data, uint64_t size);
+// Running totals of what a buffer has checked and fixed
+typedef struct ecc_buffer_stats {
+    // Chunks whose parity was actually checked
+    uint64_t chunks_checked;
+    // Chunks that had errors, and how many symbols were fixed in them
+    uint64_t chunks_corrected;
+    uint64_t symbols_corrected;
+    // Checks that found more errors than the parity could fix
+    uint64_t uncorrectable;
+    // Chunks the scrubber has gone over, and full passes it's finished
+    uint64_t scrubbed_chunks;
+    uint64_t scrub_passes;
+    // Dirty chunks whose parity has been brought up to date in write-back
+    // mode
+    uint64_t chunks_flushed;
+} ecc_buffer_stats_t;
+
+// How the background scrubber runs
+typedef struct ecc_scrubber_config {
+    // Most data bytes to scrub per second, 0 for no limit
+    uint64_t bytes_per_second;
+    // CPU to pin the thread to, -1 to let it go anywhere
+    int cpu;
+} ecc_scrubber_config_t;
+
+// How write-back mode runs
+typedef struct ecc_write_back_config {
+    // Longest a chunk is meant to stay dirty, in microseconds, at least
+    // 4. A thread flushes the ones that get old. 0 for no thread, so 
+    // chunks only get flushed when they're read, scrubbed or 
+    // ecc_buffer_flush is called.
+    uint64_t max_dirty_us;
+    // CPU to pin the thread to, -1 to let it go anywhere
+    int cpu;
+} ecc_write_back_config_t;
+
+/*
+    * Gets the size of the memory a buffer needs, bookkeeping included
+    * @param size Number of bytes the buffer holds
+    * @return Size of the memory in bytes, 0 if size is 0
+*/
+size_t ecc_buffer_memory_size(uint64_t size);
+
+/*
+    * Sets up a buffer in caller provided memory. It starts out as all
+    * zeroes, which is already a valid set of codewords.
+    * @param buffer Gets the buffer
+    * @param memory Needs to be at least ecc_buffer_memory_size(size) and
+    *       aligned to ECC_BUFFER_ALIGN. It belongs to the buffer until
+    *       ecc_buffer_free.
+    * @param size Number of bytes the buffer holds
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int ecc_buffer_init(ecc_buffer_t** buffer, void* memory, uint64_t size);
+
+/*
+    * Tears down a buffer, stopping its scrubber and write-back thread 
+    * if it has them. The memory can be reused after.
+    * @param buffer Buffer to free
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int ecc_buffer_free(ecc_buffer_t* buffer);
+
+/*
+    * Writes into the buffer and updates the parity of every chunk it
+    * touches, or in write-back mode marks them dirty. Chunks it only 
+    * partly covers get checked first so an error already in them isn't 
+    * locked in.
+    * @param buffer Buffer to write to
+    * @param offset Where to start writing
+    * @param data Bytes to write
+    * @param size Number of bytes to write
+    * @return 0 if the operation was successful, -1 if the range is
+    *       outside the buffer or a partly covered chunk has too many
+    *       errors to correct
+*/
+int ecc_buffer_set(ecc_buffer_t* buffer, uint64_t offset,
+    const data_t* data, uint64_t size);
+
+/*
+    * Reads from the buffer. Only the chunks it touches get looked at.
+    * Each one is checked, and corrected in place if it has errors, 
+    * before it's copied out, unless it was already checked or written
+    * this epoch. Reading hot data again costs nothing but the copy.
+    * @param buffer Buffer to read from
+    * @param offset Where to start reading
+    * @param data Gets the bytes read
+    * @param size Number of bytes to read
+    * @return 0 if the operation was successful, -1 if the range is
+    *       outside the buffer or a chunk has too many errors to correct
+*/
+int ecc_buffer_get(ecc_buffer_t* buffer, uint64_t offset,
+    data_t* data, uint64_t size);
+
+/*
+    * Checks a range like a read does, correcting it in place if needed, 
+    * and gives back a pointer to it in the buffer instead of copying it
+    * out. The whole buffer's data is contiguous, so the range is too.
+    * The pointer stays valid until ecc_buffer_free, but what it points
+    * at is only known good as of the call. It changes under it if the
+    * range gets written, and errors after that aren't seen until the 
+    * next view or read in a new epoch.
+    * @param buffer Buffer to look at
+    * @param offset Where the range starts
+    * @param size Number of bytes in the range
+    * @return Pointer to the data at offset, or 0 if the range is outside
+    *       the buffer or a chunk has too many errors to correct
+*/
+const data_t* ecc_buffer_view(ecc_buffer_t* buffer, uint64_t offset, 
+    uint64_t size);
+
+/*
+    * Starts a new epoch, so every chunk gets checked again the next 
+    * time it's read. Errors that show up in memory after a chunk was 
+    * checked aren't seen by reads until then.
+    * @param buffer Buffer to start the epoch on
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int ecc_buffer_new_epoch(ecc_buffer_t* buffer);
+
+/*
+    * Scrubs a run of chunks now. Every one gets checked, even ones 
+    * already checked this epoch, and corrected in place if needed.
+    * @param buffer Buffer to scrub
+    * @param first_chunk First chunk to scrub
+    * @param chunk_count Number of chunks to scrub
+    * @return 0 if the operation was successful, -1 if the run is 
+    *       outside the buffer or a chunk has too many errors to correct.
+    *       The rest of the run still gets scrubbed.
+*/
+int ecc_buffer_scrub(ecc_buffer_t* buffer, uint64_t first_chunk, 
+    uint64_t chunk_count);
+
+/*
+    * Starts a thread that scrubs the whole buffer over and over in the
+    * background, so errors in data nobody reads get fixed before they
+    * pile up. It locks one chunk at a time so reads and writes only 
+    * ever wait for a single chunk check.
+    * @param buffer Buffer to scrub
+    * @param config How to run the scrubber
+    * @return 0 if the operation was successful, -1 if it's already 
+    *       running or the thread couldn't be started
+*/
+int ecc_buffer_scrubber_start(ecc_buffer_t* buffer, 
+    const ecc_scrubber_config_t* config);
+
+/*
+    * Stops the background scrubber and waits for its thread to finish
+    * @param buffer Buffer being scrubbed
+    * @return 0 if the operation was successful, -1 if it wasn't running
+*/
+int ecc_buffer_scrubber_stop(ecc_buffer_t* buffer);
+
+/*
+    * Switches the buffer to write-back mode. Writes then only copy the
+    * data in and mark the chunks dirty, and the parity gets encoded 
+    * once when the chunk is flushed instead of on every write. Errors 
+    * in a dirty chunk can't be found or fixed, so the max dirty age is
+    * how long that can go on for.
+    * @param buffer Buffer to switch
+    * @param config How to run write-back mode
+    * @return 0 if the operation was successful, -1 if it's already in
+    *       write-back mode, max_dirty_us is 1 to 3 or the thread 
+    *       couldn't be started
+*/
+int ecc_buffer_write_back_start(ecc_buffer_t* buffer, 
+    const ecc_write_back_config_t* config);
+
+/*
+    * Flushes every dirty chunk and switches the buffer back to encoding
+    * on every write
+    * @param buffer Buffer to switch
+    * @return 0 if the operation was successful, -1 if it wasn't in 
+    *       write-back mode
+*/
+int ecc_buffer_write_back_stop(ecc_buffer_t* buffer);
+
+/*
+    * Encodes the parity of every dirty chunk now
+    * @param buffer Buffer to flush
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int ecc_buffer_flush(ecc_buffer_t* buffer);
+
+/*
+    * Gets the running totals of what a buffer has checked and fixed
+    * @param buffer Buffer to get the totals of
+    * @param stats Gets the totals
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int ecc_buffer_stats(const ecc_buffer_t* buffer, ecc_buffer_stats_t* stats);
+
+/*
+    * Gets where a chunk's data and parity are stored, without checking 
+    * them. For saving the raw codewords somewhere or injecting faults in
+    * tests.
+    * @param buffer Buffer the chunk is in
+    * @param chunk Index of the chunk
+    * @param data Gets the chunk's data
+    * @param parity Gets the chunk's ECC_BUFFER_PARITY_SIZE parity bytes
+    * @return Number of data bytes in the chunk, or -1 if there's no 
+    *       such chunk
+*/
+int ecc_buffer_chunk(ecc_buffer_t* buffer, uint64_t chunk,
+    uint8_t** data, uint8_t** parity);
 
-#endif // ECC_BUFFERS_H_
\ No newline at end of file
+#endif // ECC_BUFFERS_H_
@@ -0,0 +1,198 @@
+#include "galois_field_16.h"
+
+// Prime factors of 2^16 - 1 = 3 * 5 * 17 * 257. An element generates the
+// whole field if none of g^(65535 / p) come out to 1.
+static const uint32_t gf16_order_factors[] = { 3, 5, 17, 257 };
+
+// Peasant multiplication under a raw polynomial, for building tables
+static uint16_t gf16_mul_poly(uint16_t a, uint16_t b, uint32_t polynomial)
+{
+    uint16_t r = 0;
+    while(b > 0) {
+        if(b & 1) {
+            r ^= a;
+        }
+        b >>= 1;
+        if(a & 0x8000) {
+            a = (uint16_t)((a << 1) ^ polynomial);
+        } else {
+            a <<= 1;
+        }
+    }
+    return r;
+}
+
+static uint16_t gf16_pow_poly(uint16_t a, uint32_t pow, uint32_t polynomial)
+{
+    uint16_t r = 1;
+    while(pow > 0) {
+        if(pow & 1) {
+            r = gf16_mul_poly(r, a, polynomial);
+        }
+        a = gf16_mul_poly(a, a, polynomial);
+        pow >>= 1;
+    }
+    return r;
+}
+
+// Checks for a factor of degree 8 or less by trial division. 
+// Any reducible degree 16 polynomial has one.
+static int gf16_is_irreducible(uint32_t polynomial)
+{
+    for(uint32_t divisor = 2; divisor < 0x200; divisor++) {
+        int divisor_degree = 31 - __builtin_clz(divisor);
+        uint32_t remainder = polynomial;
+        for(int bit = 16; bit >= divisor_degree; bit--) {
+            if(remainder & (1u << bit)) {
+                remainder ^= divisor << (bit - divisor_degree);
+            }
+        }
+        if(remainder == 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int gf16_field_init(gf16_field_t* field, uint32_t polynomial)
+{
+    // Has to be degree 16 and irreducible
+    if(polynomial < 0x10000 || polynomial > 0x1FFFF) {
+        return -1;
+    }
+    if(!gf16_is_irreducible(polynomial)) {
+        return -1;
+    }
+
+    // Find the smallest primitive element
+    uint32_t generator = 0;
+    for(uint32_t g = 2; g <= 0xFFFF && generator == 0; g++) {
+        int primitive = 1;
+        for(int i = 0; i < 4; i++) {
+            uint32_t pow = GF16_ORDER / gf16_order_factors[i];
+            if(gf16_pow_poly((uint16_t)g, pow, polynomial) == 1) {
+                primitive = 0;
+                break;
+            }
+        }
+        if(primitive) {
+            generator = g;
+        }
+    }
+    if(generator == 0) {
+        return -1;
+    }
+    field->polynomial = polynomial;
+    field->generator = (uint16_t)generator;
+
+    // exp/log. The exp table is doubled so log[a] + log[b] never 
+    // needs reducing.
+    uint16_t x = 1;
+    field->log[0] = 0;
+    for(uint32_t i = 0; i < GF16_ORDER; i++) {
+        field->exp[i] = x;
+        field->exp[i + GF16_ORDER] = x;
+        field->log[x] = (uint16_t)i;
+        x = gf16_mul_poly(x, (uint16_t)generator, polynomial);
+    }
+    return 0;
+}
+
+uint16_t gf16_add(uint16_t a, uint16_t b)
+{
+    // Still just XOR
+    return a ^ b;
+}
+
+uint16_t gf16_mul_nolut(const gf16_field_t* field, uint16_t a, uint16_t b)
+{
+    return gf16_mul_poly(a, b, field->polynomial);
+}
+
+uint16_t gf16_mul(const gf16_field_t* field, uint16_t a, uint16_t b)
+{
+    // Trivial, return 0
+    if(a == 0 || b == 0) {
+        return 0;
+    }
+    return field->exp[field->log[a] + field->log[b]];
+}
+
+uint16_t gf16_div(const gf16_field_t* field, uint16_t a, uint16_t b)
+{
+    // Prevent divide by zero errors
+    if(a == 0 || b == 0) {
+        return 0;
+    }
+    return field->exp[field->log[a] + GF16_ORDER - field->log[b]];
+}
+
+uint16_t gf16_pow(const gf16_field_t* field, uint16_t a, uint32_t pow)
+{
+    if(a == 0) {
+        return (pow == 0) ? 1 : 0;
+    }
+    return field->exp[((uint64_t)field->log[a] * pow) % GF16_ORDER];
+}
+
+uint16_t gf16_inv(const gf16_field_t* field, uint16_t a)
+{
+    // Inverse of 0 is undefined, we give back 0 like gf16_div
+    if(a == 0) {
+        return 0;
+    }
+    return field->exp[GF16_ORDER - field->log[a]];
+}
+
+int gf16_poly_mul(const gf16_field_t* field, uint16_t* buffer, 
+    const uint16_t* p, const uint16_t* q, int p_len, int q_len)
+{
+    if(p_len <= 0 || q_len <= 0) {
+        return -1;
+    }
+
+    // Zero out the buffer
+    for(int i = 0; i < p_len + q_len - 1; i++) {
+        buffer[i] = 0;
+    }
+
+    // Each coefficient of p scales all of q and lands shifted by i.
+    for(int i = 0; i < p_len; i++) {
+        gf16_region_mul_xor(field, buffer + i, q, p[i], q_len);
+    }
+    return 0;
+}
+
+uint16_t gf16_poly_eval(const gf16_field_t* field, 
+    const uint16_t* p, uint16_t x, int p_len)
+{
+    if(p_len <= 0) {
+        return 0;
+    }
+
+    // Horner's method
+    uint16_t result = p[0];
+    for(int i = 1; i < p_len; i++) {
+        result = gf16_mul(field, result, x) ^ p[i];
+    }
+    return result;
+}
+
+int gf16_region_mul_xor(const gf16_field_t* field, 
+    uint16_t* dst, const uint16_t* src, uint16_t c, size_t len)
+{
+    // Adding zero does nothing
+    if(c == 0) {
+        return 0;
+    }
+
+    // Look up the log of the constant once, then it's one lookup
+    // and an add per symbol.
+    uint32_t log_c = field->log[c];
+    for(size_t i = 0; i < len; i++) {
+        if(src[i] != 0) {
+            dst[i] ^= field->exp[field->log[src[i]] + log_c];
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*
+ * Represents field operations in GF(2^16)
+ *
+ * Same idea as galois_field_8.h, but with 16 bit symbols so 
+ * Reed-Solomon codewords can be up to 65535 symbols long.
+ */
+
+#ifndef _GALOIS_FIELD_16_H_
+#define _GALOIS_FIELD_16_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// x^16 + x^12 + x^3 + x + 1, primitive
+#define GF16_POLYNOMIAL_DEFAULT 0x1100B
+
+// Number of non zero elements, which is also the longest codeword
+#define GF16_ORDER 0xFFFF
+
+// The exp table is doubled so log[a] + log[b] can index it directly
+#define GF16_EXP_TABLE_SIZE (GF16_ORDER * 2)
+#define GF16_LOG_TABLE_SIZE (GF16_ORDER + 1)
+
+// A GF(2^16) field under a given polynomial, with its lookup tables.
+// It's about 384KB, so it's best kept static. Nothing in here is 
+// modified after gf16_field_init, so a field can be shared between 
+// threads.
+typedef struct gf16_field {
+    // Degree 16 irreducible polynomial [Ex: 0x1100B]
+    uint32_t polynomial;
+    // Primitive element (alpha) the exp/log tables are built on
+    uint16_t generator;
+
+    // exp[i] = alpha^i, log[alpha^i] = i
+    uint16_t exp[GF16_EXP_TABLE_SIZE];
+    uint16_t log[GF16_LOG_TABLE_SIZE];
+} gf16_field_t;
+
+/*
+    * Builds the lookup tables for GF(2^16) under a polynomial
+    * @param field Field to initialize
+    * @param polynomial Degree 16 irreducible polynomial [Ex: 0x1100B]
+    *       The smallest primitive element is used as the generator.
+    * @return 0 if initialization was successful, -1 if the polynomial
+    *       isn't degree 16 or isn't irreducible
+*/
+int gf16_field_init(gf16_field_t* field, uint32_t polynomial);
+
+/*
+    * Adds two numbers in GF(2^16)
+    * @param a First number
+    * @param b Second number
+    * @return Sum of a and b in GF(2^16)
+*/
+uint16_t gf16_add(uint16_t a, uint16_t b);
+
+/*
+    * Multiplies two numbers in GF(2^16)
+    * @param field Field to work in
+    * @param a First number
+    * @param b Second number
+    * @return Product of a and b in GF(2^16)
+*/
+uint16_t gf16_mul(const gf16_field_t* field, uint16_t a, uint16_t b);
+uint16_t gf16_mul_nolut(const gf16_field_t* field, uint16_t a, uint16_t b);
+
+/*
+    * Divides two numbers in GF(2^16)
+    * @param field Field to work in
+    * @param a First number. Dividend
+    * @param b Second number. Divisor
+    * @return Quotient of a and b in GF(2^16), 0 if b is 0
+*/
+uint16_t gf16_div(const gf16_field_t* field, uint16_t a, uint16_t b);
+
+/*
+    * Raises a number to a power in GF(2^16)
+    * @param field Field to work in
+    * @param a Base
+    * @param pow Exponent
+    * @return a raised to the power of pow in GF(2^16)
+*/
+uint16_t gf16_pow(const gf16_field_t* field, uint16_t a, uint32_t pow);
+
+/*
+    * Inverts a number in GF(2^16)
+    * @param field Field to work in
+    * @param a Number to invert
+    * @return Inverse of a in GF(2^16), 0 if a is 0
+*/
+uint16_t gf16_inv(const gf16_field_t* field, uint16_t a);
+
+/*
+    * Multiplies two polynomials in GF(2^16)
+    * @param field Field to work in
+    * @param buffer The buffer should be at least the size
+    *       of the sum of the lengths of both polynomials
+    * @param p First polynomial
+    * @param q Second polynomial
+    * @param p_len Length of the polynomial p
+    * @param q_len Length of the polynomial q
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int gf16_poly_mul(const gf16_field_t* field, uint16_t* buffer, 
+    const uint16_t* p, const uint16_t* q, int p_len, int q_len);
+
+/*
+    * Evaluates a polynomial in GF(2^16) and returns a scalar
+    * @param field Field to work in
+    * @param p Polynomial to evaluate, highest order first
+    * @param x Value to evaluate the polynomial at
+    * @param p_len Length of the polynomial
+    * @return Scalar value of the polynomial
+*/
+uint16_t gf16_poly_eval(const gf16_field_t* field, 
+    const uint16_t* p, uint16_t x, int p_len);
+
+/*
+    * Multiplies every symbol of a region by a constant in GF(2^16) and
+    * adds (XORs) the result into the destination. 
+    * ie. dst[i] = dst[i] + c * src[i]
+    * @param field Field to work in
+    * @param dst Destination region, at least len symbols
+    * @param src Source region, at least len symbols
+    * @param c Constant to multiply by
+    * @param len Length of the regions in symbols
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int gf16_region_mul_xor(const gf16_field_t* field, 
+    uint16_t* dst, const uint16_t* src, uint16_t c, size_t len);
+
+#endif
@@ -10,35 +10,139 @@
 // Lastly, theoretical help from https://downloads.bbc.co.uk/rd/pubs/whp/whp-pdf-files/WHP031.pdf 
 //      for debugging
 
-// For lazy initialization of the gf8 field library.
-// By default, will initialize whenever it requires lookup tables 
-// or other settings.
-// If disabled, remember to call gf8_init() manually in your code.
-#define GF8_LAZY_INIT 1
-int gf8_initialized = 0;
-
-// I selected this degree 8 primitive polynomial. 
-// As long as it's consistent.. should be fine
-#define GF8_PRIMITIVE_POLYNOMIAL 0x11D
-
-// Size should be 2^8 + 1 to encompass all elements.
-#define GF8_EXP_TABLE_SIZE (0xFF + 1)
-#define GF8_LOG_TABLE_SIZE (0xFF + 1)
-
-// Lookup tables for multiplications in GF(2^8)
-uint8_t gf8_exp[GF8_EXP_TABLE_SIZE] = {0};
-uint8_t gf8_log[GF8_LOG_TABLE_SIZE] = {0};
-
-int gf8_init()
+// The AES field, which is the only one GF2P8MULB knows about
+#define GF8_AES_POLYNOMIAL 0x11B
+
+// Peasant multiplication under a raw polynomial, for building tables
+static uint8_t gf8_mul_poly(uint8_t a, uint8_t b, uint16_t polynomial)
+{
+    uint8_t r = 0;
+    while(b > 0) {
+        if(b & 1) {
+            r ^= a;
+        }
+        b >>= 1;
+        if(a & 0x80) {
+            a = (uint8_t)((a << 1) ^ polynomial);
+        } else {
+            a <<= 1;
+        }
+    }
+    return r;
+}
+
+// Packs the images of x^0 .. x^7 under a linear map into the 8x8 bit
+// matrix GF2P8AFFINEQB expects. Row i (the bits that make up bit i of 
+// the result) lives in byte 7 - i, so this is a bit transpose followed
+// by a byte swap.
+static uint64_t gf8_affine_matrix(const uint8_t* columns)
 {
-    // Initialize the lookup tables for multiplications in GF(2^8)
+    uint64_t x = 0;
+    for(int j = 0; j < 8; j++) {
+        x |= (uint64_t)columns[j] << (8 * j);
+    }
+
+    uint64_t t;
+    t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+    x = x ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+    x = x ^ t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+    x = x ^ t ^ (t << 28);
+
+    return __builtin_bswap64(x);
+}
+
+int gf8_field_init(gf8_field_t* field, uint16_t polynomial)
+{
+    // Has to be degree 8
+    if(polynomial < 0x100 || polynomial > 0x1FF) {
+        return -1;
+    }
+
+    // Find the smallest element that generates every non zero element.
+    // If the polynomial is reducible there isn't one.
+    int generator = 0;
+    for(int g = 2; g <= 0xFF && generator == 0; g++) {
+        uint8_t x = (uint8_t)g;
+        int order = 1;
+        while(x != 1 && order < 0xFF) {
+            x = gf8_mul_poly(x, (uint8_t)g, polynomial);
+            order++;
+        }
+        if(x == 1 && order == 0xFF) {
+            generator = g;
+        }
+    }
+    if(generator == 0) {
+        return -1;
+    }
+    field->polynomial = polynomial;
+    field->generator = (uint8_t)generator;
+
+    // exp/log. The exp table is doubled so log[a] + log[b] never 
+    // needs reducing mod 255.
     uint8_t x = 1;
-    for(uint8_t i = 0; i < 0xFF; i++) {
-        gf8_exp[i] = x;
-        gf8_log[x] = i;
-        x = gf8_mul_nolut(x, 2);
+    field->log[0] = 0;
+    for(int i = 0; i < 0xFF; i++) {
+        field->exp[i] = x;
+        field->exp[i + 0xFF] = x;
+        field->log[x] = (uint8_t)i;
+        x = gf8_mul_poly(x, (uint8_t)generator, polynomial);
+    }
+
+    // Nibble product tables and affine matrices for every constant
+    for(int c = 0; c <= 0xFF; c++) {
+        uint8_t columns[8];
+        for(int i = 0; i < 16; i++) {
+            field->mul_lo[c][i] = gf8_mul_poly((uint8_t)c, (uint8_t)i,
+                polynomial);
+            field->mul_hi[c][i] = gf8_mul_poly((uint8_t)c, 
+                (uint8_t)(i << 4), polynomial);
+        }
+        for(int i = 0; i < 8; i++) {
+            columns[i] = gf8_mul_poly((uint8_t)c, (uint8_t)(1 << i),
+                polynomial);
+        }
+        field->affine[c] = gf8_affine_matrix(columns);
+    }
+
+    // Isomorphism onto the AES field. Sending x to any root of our
+    // polynomial in the AES field does it, and there is always one
+    // since both are fields of the same size.
+    uint8_t beta = 0;
+    for(int b = 2; b <= 0xFF && beta == 0; b++) {
+        uint8_t value = 0;
+        uint8_t power = 1;
+        for(int i = 0; i <= 8; i++) {
+            if(polynomial & (1 << i)) {
+                value ^= power;
+            }
+            power = gf8_mul_poly(power, (uint8_t)b, GF8_AES_POLYNOMIAL);
+        }
+        if(value == 0) {
+            beta = (uint8_t)b;
+        }
+    }
+    uint8_t from_aes_columns[8] = {0};
+    for(int a = 0; a <= 0xFF; a++) {
+        uint8_t image = 0;
+        uint8_t power = 1;
+        for(int i = 0; i < 8; i++) {
+            if(a & (1 << i)) {
+                image ^= power;
+            }
+            power = gf8_mul_poly(power, beta, GF8_AES_POLYNOMIAL);
+        }
+        field->to_aes[a] = image;
+        for(int i = 0; i < 8; i++) {
+            if(image == (1 << i)) {
+                from_aes_columns[i] = (uint8_t)a;
+            }
+        }
     }
-    gf8_initialized = 1;
+    field->from_aes_affine = gf8_affine_matrix(from_aes_columns);
+
     return 0;
 }
 
@@ -55,7 +159,7 @@ uint8_t gf8_sub(uint8_t a, uint8_t b)
 }
 
 // Uses the https://www.cut-the-knot.org/Curriculum/Algebra/PeasantMultiplication.shtml
-uint8_t gf8_mul_nolut(uint8_t a, uint8_t b)
+uint8_t gf8_mul_nolut(const gf8_field_t* field, uint8_t a, uint8_t b)
 {
     // We allocate a larger buffer to work with as a might overflow 8 bits.
     uint8_t r = 0;
@@ -71,7 +175,7 @@ uint8_t gf8_mul_nolut(uint8_t a, uint8_t b)
         // If the left most bit is high, 
         //  divide by the primitive polynomial
         if(a & 0x80) {
-            a = (a << 1) ^ GF8_PRIMITIVE_POLYNOMIAL;
+            a = (a << 1) ^ field->polynomial;
         } else {
             a <<= 1;
         }
@@ -80,75 +184,54 @@ uint8_t gf8_mul_nolut(uint8_t a, uint8_t b)
     return r;
 }
 
-uint8_t gf8_mul(uint8_t a, uint8_t b)
+uint8_t gf8_mul(const gf8_field_t* field, uint8_t a, uint8_t b)
 {
-    // Initialize GF8 if not already initialized
-    if(GF8_LAZY_INIT && !gf8_initialized) {
-        gf8_init();
-    }
-
     // Trivial, return 0
     if(a == 0 || b == 0) {
         return 0;
     }
 
     // Multiply two numbers in GF(2^8) using the lookup tables
-    int lookup_index = gf8_log[a] + gf8_log[b];
-    if (lookup_index > 0xFF) {
-        lookup_index -= 0xFF;
-    }
-    return gf8_exp[lookup_index];
+    // The exp table is doubled so the sum of the logs doesn't
+    // need reducing.
+    return field->exp[field->log[a] + field->log[b]];
 }
 
-uint8_t gf8_div(uint8_t a, uint8_t b)
+uint8_t gf8_div(const gf8_field_t* field, uint8_t a, uint8_t b)
 {
-    // Initialize GF8 if not already initialized
-    if(GF8_LAZY_INIT && !gf8_initialized) {
-        gf8_init();
-    }
-
     // Prevent divide by zero errors
     if(a == 0 || b == 0) {
         return 0;
     }
     // Divide two numbers in GF(2^8) using the lookup tables
-    // Adding 0xFF allows us to not underflow
-    // The mod 0xFF makes sure we stay within the bounds (and field)
-    return gf8_exp[(gf8_log[a] + 0xFF - gf8_log[b]) % 0xFF];
+    // Adding 0xFF allows us to not underflow, and the doubled 
+    // exp table covers the rest of the range.
+    return field->exp[field->log[a] + 0xFF - field->log[b]];
 }
 
-uint8_t gf8_pow(uint8_t a, uint8_t pow)
+uint8_t gf8_pow(const gf8_field_t* field, uint8_t a, uint8_t pow)
 {
-    // Initialize GF8 if not already initialized
-    if(GF8_LAZY_INIT && !gf8_initialized) {
-        gf8_init();
-    }
-
-    return gf8_exp[(gf8_log[a] * pow) % 0xFF];
+    return field->exp[(field->log[a] * pow) % 0xFF];
 }
 
-uint8_t gf8_inv(uint8_t a)
+uint8_t gf8_inv(const gf8_field_t* field, uint8_t a)
 {
-    // Initialize GF8 if not already initialized
-    if(GF8_LAZY_INIT && !gf8_initialized) {
-        gf8_init();
+    // Inverse of 0 is undefined, we give back 0 like gf8_div
+    if(a == 0) {
+        return 0;
     }
-
-    return gf8_div(1, a);
+    return field->exp[0xFF - field->log[a]];
 }
 
-int gf8_poly_scale(uint8_t* buffer, uint8_t* p, 
-    uint8_t scale, uint8_t p_len)
+int gf8_poly_scale(const gf8_field_t* field, uint8_t* buffer, 
+    uint8_t* p, uint8_t scale, int p_len)
 {
     // Simply multiply each coef by the scale
-    for(int i = 0; i < p_len; i++) {
-        buffer[i] = gf8_mul(p[i], scale);
-    }
-    return 0;
+    return gf8_region_mul(field, buffer, p, scale, p_len);
 }
 
 int gf8_poly_add(uint8_t* buffer, uint8_t* p, uint8_t* q, 
-    uint8_t p_len, uint8_t q_len)
+    int p_len, int q_len)
 {
     // Pick the larger of the lengths
     int max_len = (p_len > q_len) ? p_len : q_len;
@@ -171,32 +254,32 @@ int gf8_poly_add(uint8_t* buffer, uint8_t* p, uint8_t* q,
     return 0;
 }
 
-int gf8_poly_mul(uint8_t* buffer, uint8_t* p, uint8_t* q, 
-    uint8_t p_len, uint8_t q_len)
+int gf8_poly_mul(const gf8_field_t* field, uint8_t* buffer, 
+    uint8_t* p, uint8_t* q, int p_len, int q_len)
 {
     // Zero out the buffer
     for(int i = 0; i < p_len + q_len - 1; i++) {
         buffer[i] = 0;
     }
 
-    // This is your run of the mill polynomial multiplication
+    // This is your run of the mill polynomial multiplication.
+    // Each coefficient of p scales all of q and lands shifted by i.
     for(int i = 0; i < p_len; i++) {
-        for(int j = 0; j < q_len; j++) {
-            buffer[i + j] ^= gf8_mul(p[i], q[j]);
-        }
+        gf8_region_mul_xor(field, buffer + i, q, p[i], q_len);
     }
     return 0;
 }
 
-int gf8_poly_div(uint8_t* buffer_quotient, uint8_t* buffer_remainder, 
-    uint8_t* p, uint8_t* q, uint8_t p_len, uint8_t q_len)
+int gf8_poly_div(const gf8_field_t* field, 
+    uint8_t* buffer_quotient, uint8_t* buffer_remainder, 
+    uint8_t* p, uint8_t* q, int p_len, int q_len)
 {
     // Sanity checks, divisor (q) can't be larger than dividend (p)
-    if(q_len >= p_len) {
+    if(q_len > p_len) {
         return -1;
     }
-    // q_len and p_len can't be 0
-    if(p_len == 0 || q_len == 0) {
+    // q_len and p_len have to be positive
+    if(p_len <= 0 || q_len <= 0) {
         return -1;
     }
 
@@ -210,17 +293,6 @@ int gf8_poly_div(uint8_t* buffer_quotient, uint8_t* buffer_remainder,
         buffer_remainder[i] = 0;
     }
 
-    // If p_len and q_len are the same size, but different, then
-    // they aren't divisible. If they are the same, then the result 
-    // I think is 1, but I'd have to write it out...
-    // For now, we'll just return an error and give back the quotient
-    // and remainder...
-    //
-    // TODO: Handle this edge case appropiately.
-    if(p_len == q_len) {
-        return -1;
-    }
-
     // When polynomials are non-monic, we need the normalizer
     uint8_t normalizer = q[0];
     if(normalizer == 0)
@@ -230,20 +302,19 @@ int gf8_poly_div(uint8_t* buffer_quotient, uint8_t* buffer_remainder,
     // the wikiversity page since it seems faster and more concise than 
     // the general synthetic division method.
     for(int i = 0; i < (p_len - (q_len - 1)); i++) {
-        // Normalize the coefficient
-        buffer_quotient[i] = gf8_div(buffer_quotient[i], normalizer);
+        // Normalize the coefficient. Monic divisors (like the RS 
+        // generator) don't need it.
+        if(normalizer != 1) {
+            buffer_quotient[i] = gf8_div(field, buffer_quotient[i], normalizer);
+        }
         // Grab the current coefficient.
         uint8_t coef = buffer_quotient[i];
         // Avoid 0 since log(0) is undefined.
         if(coef != 0) { 
-            // Skip first coefficient for the divisor.
-            for(int j = 1; j < q_len; j++) {   
-                // Zero doesnt really do anything
-                if(q[j] != 0) {
-                    // Do the actual math
-                    buffer_quotient[i+j] ^= gf8_mul(q[j], coef); 
-                } 
-            }
+            // Skip first coefficient for the divisor and do the 
+            // actual math on the rest of it in one go.
+            gf8_region_mul_xor(field, buffer_quotient + i + 1, q + 1, 
+                coef, q_len - 1);
         }
     }
 
@@ -282,12 +353,13 @@ int gf8_poly_div(uint8_t* buffer_quotient, uint8_t* buffer_remainder,
     return 0;
 }
 
-uint8_t gf8_poly_eval(uint8_t* p, uint8_t x, uint8_t p_len)
+uint8_t gf8_poly_eval(const gf8_field_t* field, 
+    uint8_t* p, uint8_t x, int p_len)
 {
     int result = p[0];
     for(int i = 1; i < p_len; i++)
     {
-        result = gf8_add(gf8_mul(result, x), p[i]);
+        result = gf8_add(gf8_mul(field, result, x), p[i]);
     }
     return result;
 }
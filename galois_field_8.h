@@ -6,12 +6,60 @@
 #define _GALOIS_FIELD_8_H_
 
 #include <stdint.h>
+#include <stddef.h>
+
+// Some degree 8 polynomials in common use
+#define GF8_POLYNOMIAL_DEFAULT 0x11D    // What we've always used
+#define GF8_POLYNOMIAL_CCSDS 0x187      // CCSDS / deep space RS codes
+#define GF8_POLYNOMIAL_AES 0x11B        // Irreducible, but 2 isn't a generator
+
+// The exp table is doubled (2 * 255) so log[a] + log[b] can index it
+// directly without reducing mod 255.
+#define GF8_EXP_TABLE_SIZE (0xFF * 2)
+#define GF8_LOG_TABLE_SIZE (0xFF + 1)
+
+// A GF(2^8) field under a given polynomial, with all of its lookup 
+// tables. Every gf8_* and rs_* call takes one, so fields under different
+// polynomials can be used side by side. Nothing in here is modified
+// after gf8_field_init, so a field can be shared between threads.
+typedef struct gf8_field {
+    // Degree 8 irreducible polynomial [Ex: 0x11D]
+    uint16_t polynomial;
+    // Primitive element (alpha) the exp/log tables are built on
+    uint8_t generator;
+
+    // exp[i] = alpha^i, log[alpha^i] = i
+    uint8_t exp[GF8_EXP_TABLE_SIZE];
+    uint8_t log[GF8_LOG_TABLE_SIZE];
+
+    // Low and high nibble products for every constant, for the PSHUFB 
+    // region kernels. ie. mul_lo[c][i] = c * i, mul_hi[c][i] = c * (i << 4)
+    uint8_t mul_lo[256][16];
+    uint8_t mul_hi[256][16];
+
+    // Multiplication by every constant as a GF2P8AFFINEQB bit matrix
+    uint64_t affine[256];
+
+    // Linear isomorphism onto the AES field (0x11B) and the matrix that 
+    // maps back, so GF2P8MULB can be used for variable by variable 
+    // products.
+    uint8_t to_aes[256];
+    uint64_t from_aes_affine;
+} gf8_field_t;
+
+// The 0x11D field. Its tables are generated at build time 
+// (galois_field_8_tables.c) so it never needs initializing.
+extern const gf8_field_t gf8_field_default;
 
 /*
-    * Initializes the lookup tables for multiplications in GF(2^8)
-    * @return 0 if initialization was successful, -1 otherwise
+    * Builds the lookup tables for GF(2^8) under a polynomial
+    * @param field Field to initialize
+    * @param polynomial Degree 8 irreducible polynomial [Ex: 0x187]
+    *       The smallest primitive element is used as the generator.
+    * @return 0 if initialization was successful, -1 if the polynomial
+    *       isn't degree 8 or isn't irreducible
 */
-int gf8_init();
+int gf8_field_init(gf8_field_t* field, uint16_t polynomial);
 
 /*
     * Adds two numbers in GF(2^8)
@@ -33,38 +81,43 @@ uint8_t gf8_sub(uint8_t a, uint8_t b);
 
 /*
     * Multiplies two numbers in GF(2^8)
+    * @param field Field to work in
     * @param a First number
     * @param b Second number
     * @return Product of a and b in GF(2^8)
 */
-uint8_t gf8_mul(uint8_t a, uint8_t b);
-uint8_t gf8_mul_nolut(uint8_t a, uint8_t b);
+uint8_t gf8_mul(const gf8_field_t* field, uint8_t a, uint8_t b);
+uint8_t gf8_mul_nolut(const gf8_field_t* field, uint8_t a, uint8_t b);
 
 /*
     * Divides two numbers in GF(2^8)
+    * @param field Field to work in
     * @param a First number. Dividend
     * @param b Second number. Divisor
     * @return Quotient of a and b in GF(2^8)
 */
-uint8_t gf8_div(uint8_t a, uint8_t b);
+uint8_t gf8_div(const gf8_field_t* field, uint8_t a, uint8_t b);
 
 /*
     * Raises a number to a power in GF(2^8)
+    * @param field Field to work in
     * @param a Base
     * @param pow Exponent
     * @return a raised to the power of pow in GF(2^8)
 */
-uint8_t gf8_pow(uint8_t a, uint8_t pow);
+uint8_t gf8_pow(const gf8_field_t* field, uint8_t a, uint8_t pow);
 
 /*
     * Inverts a number in GF(2^8)
+    * @param field Field to work in
     * @param a Number to invert
     * @return Inverse of a in GF(2^8)
 */
-uint8_t gf8_inv(uint8_t a);
+uint8_t gf8_inv(const gf8_field_t* field, uint8_t a);
 
 /*
     * Multiplies a number by a scalar in GF(2^8)
+    * @param field Field to work in
     * @param buffer The buffer should be at least the size
     *       of the polynomial
     *       [Ex: 2x^2 + 2x^1 + 2x^0]
@@ -73,7 +126,8 @@ uint8_t gf8_inv(uint8_t a);
     * @param length Length of the polynomial p
     * @return 0 if the operation was successful, -1 otherwise
 */
-int gf8_poly_scale(uint8_t* buffer, uint8_t* p, uint8_t scale, uint8_t p_len);
+int gf8_poly_scale(const gf8_field_t* field, uint8_t* buffer, 
+    uint8_t* p, uint8_t scale, int p_len);
 
 /*
     * Adds two polynomials in GF(2^8)
@@ -87,10 +141,11 @@ int gf8_poly_scale(uint8_t* buffer, uint8_t* p, uint8_t scale, uint8_t p_len);
     * @return 0 if the operation was successful, -1 otherwise
 */
 int gf8_poly_add(uint8_t* buffer, uint8_t* p, uint8_t* q, 
-    uint8_t p_len, uint8_t q_len);
+    int p_len, int q_len);
 
 /*
     * Multiplies two polynomials in GF(2^8)
+    * @param field Field to work in
     * @param buffer The buffer should be at least the size
     *       of the sum of the lengths of both polynomials
     *       [Ex: x^5 + x^4 + .. +x^0]
@@ -100,13 +155,14 @@ int gf8_poly_add(uint8_t* buffer, uint8_t* p, uint8_t* q,
     * @param q_len Length of the polynomial q
     * @return 0 if the operation was successful, -1 otherwise
 */
-int gf8_poly_mul(uint8_t* buffer, uint8_t* p, uint8_t* q, 
-    uint8_t p_len, uint8_t q_len);
+int gf8_poly_mul(const gf8_field_t* field, uint8_t* buffer, 
+    uint8_t* p, uint8_t* q, int p_len, int q_len);
 
 /*
     * Divides two polynomials in GF(2^8).
     * We expect polynomials to go from highest to lowest order like normal.
     * 
+    * @param field Field to work in
     * @param buffer_quotient The buffer should be at least the size 
     *       of the p polynomial (dividend)
     * @param buffer_remainder The buffer should be at least the size 
@@ -119,16 +175,133 @@ int gf8_poly_mul(uint8_t* buffer, uint8_t* p, uint8_t* q,
     * @param q_len Length of the polynomial q
     * @return 0 if the operation was successful, -1 otherwise
 */
-int gf8_poly_div(uint8_t* buffer_quotient, uint8_t* buffer_remainder,
-     uint8_t* p, uint8_t* q, uint8_t p_len, uint8_t q_len);
+int gf8_poly_div(const gf8_field_t* field, 
+    uint8_t* buffer_quotient, uint8_t* buffer_remainder,
+    uint8_t* p, uint8_t* q, int p_len, int q_len);
 
 /*
     * Evaluates a polynomial in GF(2^8) and returns a scalar
+    * @param field Field to work in
     * @param p Polynomial to evaluate
     * @param x Value to evaluate the polynomial at
     * @param p_len Length of the polynomial
     * @return Scalar value of the polynomial
 */
-uint8_t gf8_poly_eval(uint8_t* p, uint8_t x, uint8_t p_len);
+uint8_t gf8_poly_eval(const gf8_field_t* field, 
+    uint8_t* p, uint8_t x, int p_len);
+
+// Region kernel implementations, from slowest to fastest.
+// The fastest one the CPU supports is picked at startup.
+typedef enum gf8_impl {
+    GF8_IMPL_SCALAR = 0,
+    GF8_IMPL_SSSE3,
+    GF8_IMPL_AVX2,
+    GF8_IMPL_GFNI,      // GFNI + AVX-512BW
+    GF8_IMPL_COUNT
+} gf8_impl_t;
+
+/*
+    * Checks if this CPU can run a region kernel implementation
+    * @param impl Implementation to check
+    * @return 1 if it's supported, 0 otherwise
+*/
+int gf8_region_impl_supported(gf8_impl_t impl);
+
+/*
+    * Gets a printable name for a region kernel implementation
+    * @param impl Implementation to name
+    * @return Name of the implementation [Ex: "avx2"]
+*/
+const char* gf8_region_impl_name(gf8_impl_t impl);
+
+/*
+    * Gets the region kernel implementation currently in use
+    * @return The implementation in use
+*/
+gf8_impl_t gf8_region_impl(void);
+
+/*
+    * Forces a region kernel implementation, mostly for tests and
+    * benchmarks. Not thread safe, call it before using the region
+    * operations.
+    * @param impl Implementation to use
+    * @return 0 if the operation was successful, -1 if the CPU 
+    *       doesn't support it
+*/
+int gf8_region_set_impl(gf8_impl_t impl);
+
+/*
+    * Multiplies every byte of a region by a constant in GF(2^8)
+    * @param field Field to work in
+    * @param dst Destination region, at least len bytes.
+    *       May be the same as src.
+    * @param src Source region, at least len bytes
+    * @param c Constant to multiply by
+    * @param len Length of the regions
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int gf8_region_mul(const gf8_field_t* field, 
+    uint8_t* dst, const uint8_t* src, uint8_t c, size_t len);
+
+/*
+    * Multiplies every byte of a region by a constant in GF(2^8) and
+    * adds (XORs) the result into the destination. 
+    * ie. dst[i] = dst[i] + c * src[i]
+    * @param field Field to work in
+    * @param dst Destination region, at least len bytes
+    * @param src Source region, at least len bytes
+    * @param c Constant to multiply by
+    * @param len Length of the regions
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int gf8_region_mul_xor(const gf8_field_t* field, 
+    uint8_t* dst, const uint8_t* src, uint8_t c, size_t len);
+
+/*
+    * Multiplies a vector by a matrix in GF(2^8). Each output byte is its
+    * own dot product down a column, ie.
+    * dst[j] = sum of coefficients[i] * matrix[i * stride + j]
+    * @param field Field to work in
+    * @param dst Destination, at least len bytes. Can't overlap the matrix.
+    * @param matrix First row of the matrix
+    * @param stride Distance between rows in bytes
+    * @param coefficients One coefficient per row
+    * @param rows Number of rows
+    * @param len Length of the rows
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int gf8_region_dot(const gf8_field_t* field, uint8_t* dst, 
+    const uint8_t* matrix, size_t stride, const uint8_t* coefficients, 
+    int rows, size_t len);
+
+/*
+    * Evaluates a polynomial at the first count powers of the field's
+    * generator, ie. syndromes[i] = data(alpha^i)
+    * @param field Field to work in
+    * @param syndromes Needs to be at least count in size
+    * @param data Polynomial to evaluate, highest order first
+    * @param len Length of the polynomial
+    * @param count Number of powers to evaluate at
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int gf8_region_syndromes(const gf8_field_t* field, 
+    uint8_t* syndromes, const uint8_t* data, size_t len, int count);
+
+/*
+    * Evaluates a polynomial at any set of points in one pass over it, 
+    * ie. values[i] = data(points[i]). Same kernels as 
+    * gf8_region_syndromes, for roots that aren't the first powers of 
+    * the generator.
+    * @param field Field to work in
+    * @param values Needs to be at least count in size
+    * @param data Polynomial to evaluate, highest order first
+    * @param len Length of the polynomial
+    * @param points Points to evaluate at
+    * @param count Number of points
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int gf8_region_eval(const gf8_field_t* field, 
+    uint8_t* values, const uint8_t* data, size_t len, 
+    const uint8_t* points, int count);
 
 #endif
\ No newline at end of file
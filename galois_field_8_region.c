@@ -0,0 +1,745 @@
+#include "galois_field_8.h"
+
+// Region operations multiply a whole run of bytes by the same constant.
+// Multiplication by a constant is linear over GF(2), so c*x can be split
+// into the product of the low nibble and the product of the high nibble:
+//      c*x = c*(x & 0x0F) ^ c*(x & 0xF0)
+// Each half only has 16 possible values, which is exactly the size of a
+// PSHUFB lookup table. That lets SSSE3 multiply 16 bytes and AVX2
+// multiply 32 bytes with two shuffles and an XOR.
+//
+// The same linearity means c*x is an 8x8 bit matrix applied to x, which
+// is what GF2P8AFFINEQB does, 64 bytes at a time with AVX-512.
+//
+// Every kernel is compiled for its own instruction set with target
+// attributes and the best one the CPU supports is picked at startup, so
+// one binary runs everywhere. The nibble tables and matrices for every
+// constant come from the field, so the kernels work under any 
+// polynomial.
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define GF8_REGION_X86 1
+#include <immintrin.h>
+#endif
+
+// Below this length there isn't enough work to be worth loading
+// the vector tables for.
+#define GF8_REGION_MIN_VECTOR_LENGTH 16
+
+////
+// Scalar
+////
+
+// Same nibble split as the vector kernels, one byte at a time
+static void gf8_region_mul_scalar(const gf8_field_t* field,
+    uint8_t* dst, const uint8_t* src, uint8_t c, size_t len, int accumulate)
+{
+    const uint8_t* lo = field->mul_lo[c];
+    const uint8_t* hi = field->mul_hi[c];
+    for(size_t i = 0; i < len; i++) {
+        uint8_t r = lo[src[i] & 0x0F] ^ hi[src[i] >> 4];
+        dst[i] = accumulate ? (dst[i] ^ r) : r;
+    }
+}
+
+// Columns from..len of the matrix vector product
+static void gf8_region_dot_scalar_from(const gf8_field_t* field, 
+    uint8_t* dst, const uint8_t* matrix, size_t stride, 
+    const uint8_t* coefficients, int rows, size_t from, size_t len)
+{
+    for(size_t j = from; j < len; j++) {
+        dst[j] = 0;
+    }
+    for(int i = 0; i < rows; i++) {
+        gf8_region_mul_scalar(field, dst + from, matrix + i * stride + from, 
+            coefficients[i], len - from, 1);
+    }
+}
+
+static void gf8_region_dot_scalar(const gf8_field_t* field, 
+    uint8_t* dst, const uint8_t* matrix, size_t stride, 
+    const uint8_t* coefficients, int rows, size_t len)
+{
+    gf8_region_dot_scalar_from(field, dst, matrix, stride, coefficients, 
+        rows, 0, len);
+}
+
+// Syndrome kernels keep one accumulator per root and walk the data 
+// once, running every root's Horner evaluation side by side:
+//      acc[i] = acc[i] * root[i] ^ data[j]
+// Up to this many roots per pass.
+#define GF8_REGION_SYNDROME_BLOCK 64
+
+static void gf8_region_syndromes_scalar(const gf8_field_t* field,
+    uint8_t* syndromes, const uint8_t* data, size_t len, 
+    const uint8_t* points, int count)
+{
+    for(int first = 0; first < count; first += GF8_REGION_SYNDROME_BLOCK) {
+        int lanes = count - first;
+        if(lanes > GF8_REGION_SYNDROME_BLOCK) {
+            lanes = GF8_REGION_SYNDROME_BLOCK;
+        }
+
+        // Nibble tables for each root
+        const uint8_t* lo[GF8_REGION_SYNDROME_BLOCK];
+        const uint8_t* hi[GF8_REGION_SYNDROME_BLOCK];
+        uint8_t acc[GF8_REGION_SYNDROME_BLOCK] = {0};
+        for(int i = 0; i < lanes; i++) {
+            uint8_t root = points[first + i];
+            lo[i] = field->mul_lo[root];
+            hi[i] = field->mul_hi[root];
+        }
+
+        for(size_t j = 0; j < len; j++) {
+            uint8_t d = data[j];
+            for(int i = 0; i < lanes; i++) {
+                acc[i] = lo[i][acc[i] & 0x0F] ^ hi[i][acc[i] >> 4] ^ d;
+            }
+        }
+
+        for(int i = 0; i < lanes; i++) {
+            syndromes[first + i] = acc[i];
+        }
+    }
+}
+
+#ifdef GF8_REGION_X86
+
+// Every byte lane of the vector kernels has its own root, so PSHUFB 
+// tables (one constant for the whole vector) don't work. Instead acc is
+// split into bits:
+//      acc * root = sum of bit b of acc times (root * 2^b)
+// The root * 2^b vectors are computed up front and each bit of acc 
+// becomes a mask with a compare. The 8 terms don't depend on each other,
+// and every vector of roots in the block gets updated on the same pass
+// over the data, so there's plenty of independent work per byte.
+// Fills in root * 2^b for lanes roots. Both are powers of the 
+// generator, so it's just an exp lookup.
+static void gf8_region_syndrome_roots(const gf8_field_t* field, 
+    uint8_t (*root_bits)[GF8_REGION_SYNDROME_BLOCK], const uint8_t* roots, 
+    int lanes)
+{
+    int log_2 = field->log[2];
+    for(int b = 0; b < 8; b++) {
+        for(int i = 0; i < GF8_REGION_SYNDROME_BLOCK; i++) {
+            root_bits[b][i] = (i < lanes && roots[i] != 0) ? 
+                field->exp[(field->log[roots[i]] + b * log_2) % 0xFF] : 0;
+        }
+    }
+}
+
+////
+// SSSE3
+////
+
+__attribute__((target("ssse3")))
+static inline __m128i gf8_region_mul_vec_ssse3(__m128i x,
+    __m128i table_lo, __m128i table_hi)
+{
+    __m128i mask = _mm_set1_epi8(0x0F);
+    __m128i x_lo = _mm_and_si128(x, mask);
+    __m128i x_hi = _mm_and_si128(_mm_srli_epi64(x, 4), mask);
+    return _mm_xor_si128(
+        _mm_shuffle_epi8(table_lo, x_lo),
+        _mm_shuffle_epi8(table_hi, x_hi));
+}
+
+// Runs the 16 byte kernel from i onwards. Whatever is left is shorter
+// than a vector, so we rerun the last full vector of the region and
+// only keep the bytes we haven't done yet. Needs len >= 16.
+__attribute__((target("ssse3")))
+static void gf8_region_mul_ssse3_from(uint8_t* dst, const uint8_t* src,
+    __m128i table_lo, __m128i table_hi, size_t i, size_t len,
+    int accumulate)
+{
+    for(; i + 16 <= len; i += 16) {
+        __m128i r = gf8_region_mul_vec_ssse3(
+            _mm_loadu_si128((const __m128i*)(src + i)), table_lo, table_hi);
+        if(accumulate) {
+            r = _mm_xor_si128(r, _mm_loadu_si128((const __m128i*)(dst + i)));
+        }
+        _mm_storeu_si128((__m128i*)(dst + i), r);
+    }
+
+    if(i < len) {
+        static const uint8_t tail_window[32] = {
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+        };
+        size_t last = len - 16;
+        __m128i keep = _mm_loadu_si128(
+            (const __m128i*)(tail_window + (len - i)));
+        __m128i old = _mm_loadu_si128((const __m128i*)(dst + last));
+        __m128i r = gf8_region_mul_vec_ssse3(
+            _mm_loadu_si128((const __m128i*)(src + last)),
+            table_lo, table_hi);
+        if(accumulate) {
+            r = _mm_xor_si128(r, old);
+        }
+        r = _mm_or_si128(_mm_and_si128(keep, r), _mm_andnot_si128(keep, old));
+        _mm_storeu_si128((__m128i*)(dst + last), r);
+    }
+}
+
+__attribute__((target("ssse3")))
+static void gf8_region_mul_ssse3(const gf8_field_t* field,
+    uint8_t* dst, const uint8_t* src, uint8_t c, size_t len, int accumulate)
+{
+    if(len < GF8_REGION_MIN_VECTOR_LENGTH) {
+        gf8_region_mul_scalar(field, dst, src, c, len, accumulate);
+        return;
+    }
+
+    gf8_region_mul_ssse3_from(dst, src,
+        _mm_loadu_si128((const __m128i*)field->mul_lo[c]),
+        _mm_loadu_si128((const __m128i*)field->mul_hi[c]), 0, len, accumulate);
+}
+
+// 16 columns at a time from column j, the rest is done scalar.
+// A column block's accumulator stays in a register for the whole matrix.
+__attribute__((target("ssse3")))
+static void gf8_region_dot_ssse3_from(const gf8_field_t* field, 
+    uint8_t* dst, const uint8_t* matrix, size_t stride, 
+    const uint8_t* coefficients, int rows, size_t j, size_t len)
+{
+    for(; j + 16 <= len; j += 16) {
+        __m128i acc = _mm_setzero_si128();
+        for(int i = 0; i < rows; i++) {
+            uint8_t c = coefficients[i];
+            acc = _mm_xor_si128(acc, gf8_region_mul_vec_ssse3(
+                _mm_loadu_si128((const __m128i*)(matrix + i * stride + j)),
+                _mm_loadu_si128((const __m128i*)field->mul_lo[c]),
+                _mm_loadu_si128((const __m128i*)field->mul_hi[c])));
+        }
+        _mm_storeu_si128((__m128i*)(dst + j), acc);
+    }
+    if(j < len) {
+        gf8_region_dot_scalar_from(field, dst, matrix, stride, 
+            coefficients, rows, j, len);
+    }
+}
+
+__attribute__((target("ssse3")))
+static void gf8_region_dot_ssse3(const gf8_field_t* field, 
+    uint8_t* dst, const uint8_t* matrix, size_t stride, 
+    const uint8_t* coefficients, int rows, size_t len)
+{
+    gf8_region_dot_ssse3_from(field, dst, matrix, stride, coefficients, 
+        rows, 0, len);
+}
+
+// Moves bit b of every byte up to its top bit. A 16 bit shift works 
+// since nothing from the low byte reaches the top bit of the high one.
+__attribute__((target("ssse3"), always_inline))
+static inline __m128i gf8_region_bit_to_top_ssse3(__m128i x, int b)
+{
+    switch(b) {
+    case 0: return _mm_slli_epi16(x, 7);
+    case 1: return _mm_slli_epi16(x, 6);
+    case 2: return _mm_slli_epi16(x, 5);
+    case 3: return _mm_slli_epi16(x, 4);
+    case 4: return _mm_slli_epi16(x, 3);
+    case 5: return _mm_slli_epi16(x, 2);
+    case 6: return _mm_slli_epi16(x, 1);
+    default: return x;
+    }
+}
+
+// One pass over the data for 16 * vectors roots. Always inlined with a
+// constant vector count so the accumulators stay in registers.
+__attribute__((target("ssse3"), always_inline))
+static inline void gf8_region_syndromes_ssse3_pass(uint8_t* out, 
+    const uint8_t (*root_bits)[GF8_REGION_SYNDROME_BLOCK], 
+    const uint8_t* data, size_t len, int vectors)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i acc[GF8_REGION_SYNDROME_BLOCK / 16];
+    for(int w = 0; w < vectors; w++) {
+        acc[w] = _mm_setzero_si128();
+    }
+
+    for(size_t j = 0; j < len; j++) {
+        __m128i d = _mm_set1_epi8((char)data[j]);
+        for(int w = 0; w < vectors; w++) {
+            __m128i terms[8];
+            for(int b = 0; b < 8; b++) {
+                __m128i mask = _mm_cmpgt_epi8(zero, 
+                    gf8_region_bit_to_top_ssse3(acc[w], b));
+                terms[b] = _mm_and_si128(mask, _mm_loadu_si128(
+                    (const __m128i*)(root_bits[b] + w * 16)));
+            }
+            acc[w] = _mm_xor_si128(
+                _mm_xor_si128(
+                    _mm_xor_si128(terms[0], terms[1]),
+                    _mm_xor_si128(terms[2], terms[3])),
+                _mm_xor_si128(
+                    _mm_xor_si128(terms[4], terms[5]),
+                    _mm_xor_si128(_mm_xor_si128(terms[6], terms[7]), d)));
+        }
+    }
+
+    for(int w = 0; w < vectors; w++) {
+        _mm_storeu_si128((__m128i*)(out + w * 16), acc[w]);
+    }
+}
+
+__attribute__((target("ssse3")))
+static void gf8_region_syndromes_ssse3(const gf8_field_t* field,
+    uint8_t* syndromes, const uint8_t* data, size_t len, 
+    const uint8_t* points, int count)
+{
+    for(int first = 0; first < count; first += GF8_REGION_SYNDROME_BLOCK) {
+        int lanes = count - first;
+        if(lanes > GF8_REGION_SYNDROME_BLOCK) {
+            lanes = GF8_REGION_SYNDROME_BLOCK;
+        }
+
+        uint8_t root_bits[8][GF8_REGION_SYNDROME_BLOCK];
+        gf8_region_syndrome_roots(field, root_bits, points + first, lanes);
+
+        uint8_t out[GF8_REGION_SYNDROME_BLOCK];
+        switch((lanes + 15) / 16) {
+        case 1:
+            gf8_region_syndromes_ssse3_pass(out, root_bits, data, len, 1);
+            break;
+        case 2:
+            gf8_region_syndromes_ssse3_pass(out, root_bits, data, len, 2);
+            break;
+        case 3:
+            gf8_region_syndromes_ssse3_pass(out, root_bits, data, len, 3);
+            break;
+        default:
+            gf8_region_syndromes_ssse3_pass(out, root_bits, data, len, 4);
+            break;
+        }
+        for(int i = 0; i < lanes; i++) {
+            syndromes[first + i] = out[i];
+        }
+    }
+}
+
+////
+// AVX2
+////
+
+__attribute__((target("avx2")))
+static void gf8_region_mul_avx2(const gf8_field_t* field,
+    uint8_t* dst, const uint8_t* src, uint8_t c, size_t len, int accumulate)
+{
+    if(len < GF8_REGION_MIN_VECTOR_LENGTH) {
+        gf8_region_mul_scalar(field, dst, src, c, len, accumulate);
+        return;
+    }
+
+    __m128i table_lo_128 = _mm_loadu_si128((const __m128i*)field->mul_lo[c]);
+    __m128i table_hi_128 = _mm_loadu_si128((const __m128i*)field->mul_hi[c]);
+    __m256i table_lo = _mm256_broadcastsi128_si256(table_lo_128);
+    __m256i table_hi = _mm256_broadcastsi128_si256(table_hi_128);
+    __m256i mask = _mm256_set1_epi8(0x0F);
+
+    size_t i = 0;
+    for(; i + 32 <= len; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i x_lo = _mm256_and_si256(x, mask);
+        __m256i x_hi = _mm256_and_si256(_mm256_srli_epi64(x, 4), mask);
+        __m256i r = _mm256_xor_si256(
+            _mm256_shuffle_epi8(table_lo, x_lo),
+            _mm256_shuffle_epi8(table_hi, x_hi));
+        if(accumulate) {
+            r = _mm256_xor_si256(r,
+                _mm256_loadu_si256((const __m256i*)(dst + i)));
+        }
+        _mm256_storeu_si256((__m256i*)(dst + i), r);
+    }
+
+    // Let the 16 byte kernel finish off the rest
+    gf8_region_mul_ssse3_from(dst, src, table_lo_128, table_hi_128,
+        i, len, accumulate);
+}
+
+__attribute__((target("avx2")))
+static void gf8_region_dot_avx2(const gf8_field_t* field, 
+    uint8_t* dst, const uint8_t* matrix, size_t stride, 
+    const uint8_t* coefficients, int rows, size_t len)
+{
+    __m256i mask = _mm256_set1_epi8(0x0F);
+
+    size_t j = 0;
+    for(; j + 32 <= len; j += 32) {
+        __m256i acc = _mm256_setzero_si256();
+        for(int i = 0; i < rows; i++) {
+            uint8_t c = coefficients[i];
+            __m256i table_lo = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128((const __m128i*)field->mul_lo[c]));
+            __m256i table_hi = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128((const __m128i*)field->mul_hi[c]));
+            __m256i x = _mm256_loadu_si256(
+                (const __m256i*)(matrix + i * stride + j));
+            __m256i x_lo = _mm256_and_si256(x, mask);
+            __m256i x_hi = _mm256_and_si256(_mm256_srli_epi64(x, 4), mask);
+            acc = _mm256_xor_si256(acc, _mm256_xor_si256(
+                _mm256_shuffle_epi8(table_lo, x_lo),
+                _mm256_shuffle_epi8(table_hi, x_hi)));
+        }
+        _mm256_storeu_si256((__m256i*)(dst + j), acc);
+    }
+
+    // Let the 16 byte kernel finish off the rest
+    gf8_region_dot_ssse3_from(field, dst, matrix, stride, coefficients, 
+        rows, j, len);
+}
+
+__attribute__((target("avx2"), always_inline))
+static inline __m256i gf8_region_bit_to_top_avx2(__m256i x, int b)
+{
+    switch(b) {
+    case 0: return _mm256_slli_epi16(x, 7);
+    case 1: return _mm256_slli_epi16(x, 6);
+    case 2: return _mm256_slli_epi16(x, 5);
+    case 3: return _mm256_slli_epi16(x, 4);
+    case 4: return _mm256_slli_epi16(x, 3);
+    case 5: return _mm256_slli_epi16(x, 2);
+    case 6: return _mm256_slli_epi16(x, 1);
+    default: return x;
+    }
+}
+
+// Same as the SSSE3 pass, 32 roots per vector
+__attribute__((target("avx2"), always_inline))
+static inline void gf8_region_syndromes_avx2_pass(uint8_t* out, 
+    const uint8_t (*root_bits)[GF8_REGION_SYNDROME_BLOCK], 
+    const uint8_t* data, size_t len, int vectors)
+{
+    __m256i zero = _mm256_setzero_si256();
+    __m256i acc[GF8_REGION_SYNDROME_BLOCK / 32];
+    for(int w = 0; w < vectors; w++) {
+        acc[w] = _mm256_setzero_si256();
+    }
+
+    for(size_t j = 0; j < len; j++) {
+        __m256i d = _mm256_set1_epi8((char)data[j]);
+        for(int w = 0; w < vectors; w++) {
+            __m256i terms[8];
+            for(int b = 0; b < 8; b++) {
+                __m256i mask = _mm256_cmpgt_epi8(zero, 
+                    gf8_region_bit_to_top_avx2(acc[w], b));
+                terms[b] = _mm256_and_si256(mask, _mm256_loadu_si256(
+                    (const __m256i*)(root_bits[b] + w * 32)));
+            }
+            acc[w] = _mm256_xor_si256(
+                _mm256_xor_si256(
+                    _mm256_xor_si256(terms[0], terms[1]),
+                    _mm256_xor_si256(terms[2], terms[3])),
+                _mm256_xor_si256(
+                    _mm256_xor_si256(terms[4], terms[5]),
+                    _mm256_xor_si256(
+                        _mm256_xor_si256(terms[6], terms[7]), d)));
+        }
+    }
+
+    for(int w = 0; w < vectors; w++) {
+        _mm256_storeu_si256((__m256i*)(out + w * 32), acc[w]);
+    }
+}
+
+__attribute__((target("avx2")))
+static void gf8_region_syndromes_avx2(const gf8_field_t* field,
+    uint8_t* syndromes, const uint8_t* data, size_t len, 
+    const uint8_t* points, int count)
+{
+    for(int first = 0; first < count; first += GF8_REGION_SYNDROME_BLOCK) {
+        int lanes = count - first;
+        if(lanes > GF8_REGION_SYNDROME_BLOCK) {
+            lanes = GF8_REGION_SYNDROME_BLOCK;
+        }
+
+        uint8_t root_bits[8][GF8_REGION_SYNDROME_BLOCK];
+        gf8_region_syndrome_roots(field, root_bits, points + first, lanes);
+
+        uint8_t out[GF8_REGION_SYNDROME_BLOCK];
+        if(lanes <= 32) {
+            gf8_region_syndromes_avx2_pass(out, root_bits, data, len, 1);
+        } else {
+            gf8_region_syndromes_avx2_pass(out, root_bits, data, len, 2);
+        }
+        for(int i = 0; i < lanes; i++) {
+            syndromes[first + i] = out[i];
+        }
+    }
+}
+
+////
+// GFNI + AVX-512
+////
+
+__attribute__((target("avx512f,avx512bw,gfni,bmi2")))
+static void gf8_region_mul_gfni(const gf8_field_t* field,
+    uint8_t* dst, const uint8_t* src, uint8_t c, size_t len, int accumulate)
+{
+    __m512i matrix = _mm512_set1_epi64((long long)field->affine[c]);
+
+    size_t i = 0;
+    for(; i + 64 <= len; i += 64) {
+        __m512i x = _mm512_loadu_si512((const void*)(src + i));
+        __m512i r = _mm512_gf2p8affine_epi64_epi8(x, matrix, 0);
+        if(accumulate) {
+            r = _mm512_xor_si512(r,
+                _mm512_loadu_si512((const void*)(dst + i)));
+        }
+        _mm512_storeu_si512((void*)(dst + i), r);
+    }
+
+    // Byte masked loads and stores take care of the tail
+    if(i < len) {
+        __mmask64 mask = _bzhi_u64(~0ULL, (unsigned int)(len - i));
+        __m512i x = _mm512_maskz_loadu_epi8(mask, src + i);
+        __m512i r = _mm512_gf2p8affine_epi64_epi8(x, matrix, 0);
+        if(accumulate) {
+            r = _mm512_xor_si512(r, _mm512_maskz_loadu_epi8(mask, dst + i));
+        }
+        _mm512_mask_storeu_epi8(dst + i, mask, r);
+    }
+}
+
+// Each coefficient is a broadcast matrix, so a row is one
+// GF2P8AFFINEQB and an XOR.
+__attribute__((target("avx512f,avx512bw,gfni,bmi2")))
+static void gf8_region_dot_gfni(const gf8_field_t* field, 
+    uint8_t* dst, const uint8_t* matrix, size_t stride, 
+    const uint8_t* coefficients, int rows, size_t len)
+{
+    for(size_t j = 0; j < len; j += 64) {
+        __mmask64 mask = (len - j >= 64) ? ~0ULL : 
+            _bzhi_u64(~0ULL, (unsigned int)(len - j));
+        __m512i acc = _mm512_setzero_si512();
+        for(int i = 0; i < rows; i++) {
+            __m512i x = _mm512_maskz_loadu_epi8(mask, 
+                matrix + i * stride + j);
+            acc = _mm512_xor_si512(acc, _mm512_gf2p8affine_epi64_epi8(x, 
+                _mm512_set1_epi64((long long)field->affine[coefficients[i]]), 
+                0));
+        }
+        _mm512_mask_storeu_epi8(dst + j, mask, acc);
+    }
+}
+
+// GF2P8MULB multiplies two vectors byte by byte, but only in the AES
+// field (0x11B). All fields of the same size are isomorphic through a
+// linear map, so we map our field onto the AES one, multiply there, and
+// map back with GF2P8AFFINEQB.
+__attribute__((target("avx512f,avx512bw,gfni,bmi2")))
+static void gf8_region_syndromes_gfni(const gf8_field_t* field,
+    uint8_t* syndromes, const uint8_t* data, size_t len, 
+    const uint8_t* points, int count)
+{
+    __m512i from_aes = _mm512_set1_epi64((long long)field->from_aes_affine);
+
+    // 64 roots at a time, one per byte lane. Each lane runs its own
+    // Horner evaluation in the AES field:
+    //      acc = acc * root ^ data[j]
+    for(int first = 0; first < count; first += 64) {
+        uint8_t roots[64] = {0};
+        int lanes = (count - first < 64) ? count - first : 64;
+        for(int i = 0; i < lanes; i++) {
+            roots[i] = field->to_aes[points[first + i]];
+        }
+        __m512i root_vec = _mm512_loadu_si512((const void*)roots);
+
+        __m512i acc = _mm512_setzero_si512();
+        for(size_t j = 0; j < len; j++) {
+            acc = _mm512_xor_si512(_mm512_gf2p8mul_epi8(acc, root_vec),
+                _mm512_set1_epi8((char)field->to_aes[data[j]]));
+        }
+        acc = _mm512_gf2p8affine_epi64_epi8(acc, from_aes, 0);
+
+        __mmask64 mask = _bzhi_u64(~0ULL, (unsigned int)lanes);
+        _mm512_mask_storeu_epi8(syndromes + first, mask, acc);
+    }
+}
+
+#endif // GF8_REGION_X86
+
+////
+// Dispatch
+////
+
+typedef struct gf8_region_ops {
+    const char* name;
+    void (*mul)(const gf8_field_t* field, uint8_t* dst, const uint8_t* src,
+        uint8_t c, size_t len, int accumulate);
+    void (*dot)(const gf8_field_t* field, uint8_t* dst, 
+        const uint8_t* matrix, size_t stride, const uint8_t* coefficients, 
+        int rows, size_t len);
+    void (*syndromes)(const gf8_field_t* field, uint8_t* syndromes,
+        const uint8_t* data, size_t len, const uint8_t* points, int count);
+} gf8_region_ops_t;
+
+// Indexed by gf8_impl_t
+static const gf8_region_ops_t gf8_region_ops[GF8_IMPL_COUNT] = {
+    { "scalar", gf8_region_mul_scalar, gf8_region_dot_scalar, 
+        gf8_region_syndromes_scalar },
+#ifdef GF8_REGION_X86
+    { "ssse3", gf8_region_mul_ssse3, gf8_region_dot_ssse3, 
+        gf8_region_syndromes_ssse3 },
+    { "avx2", gf8_region_mul_avx2, gf8_region_dot_avx2, 
+        gf8_region_syndromes_avx2 },
+    { "gfni", gf8_region_mul_gfni, gf8_region_dot_gfni, 
+        gf8_region_syndromes_gfni },
+#else
+    { "ssse3", 0, 0, 0 },
+    { "avx2", 0, 0, 0 },
+    { "gfni", 0, 0, 0 },
+#endif
+};
+
+// Scalar until gf8_region_dispatch_init has had a look at the CPU.
+static gf8_impl_t gf8_region_current = GF8_IMPL_SCALAR;
+
+int gf8_region_impl_supported(gf8_impl_t impl)
+{
+    switch(impl) {
+    case GF8_IMPL_SCALAR:
+        return 1;
+#ifdef GF8_REGION_X86
+    case GF8_IMPL_SSSE3:
+        return __builtin_cpu_supports("ssse3");
+    case GF8_IMPL_AVX2:
+        return __builtin_cpu_supports("avx2");
+    case GF8_IMPL_GFNI:
+        return __builtin_cpu_supports("gfni") &&
+            __builtin_cpu_supports("avx512f") &&
+            __builtin_cpu_supports("avx512bw") &&
+            __builtin_cpu_supports("bmi2");
+#endif
+    default:
+        return 0;
+    }
+}
+
+const char* gf8_region_impl_name(gf8_impl_t impl)
+{
+    if(impl < 0 || impl >= GF8_IMPL_COUNT) {
+        return "unknown";
+    }
+    return gf8_region_ops[impl].name;
+}
+
+gf8_impl_t gf8_region_impl(void)
+{
+    return gf8_region_current;
+}
+
+int gf8_region_set_impl(gf8_impl_t impl)
+{
+    if(!gf8_region_impl_supported(impl)) {
+        return -1;
+    }
+    gf8_region_current = impl;
+    return 0;
+}
+
+// Picks the best kernels for this CPU before main runs.
+__attribute__((constructor))
+static void gf8_region_dispatch_init()
+{
+#ifdef GF8_REGION_X86
+    __builtin_cpu_init();
+#endif
+    for(int impl = GF8_IMPL_COUNT - 1; impl >= 0; impl--) {
+        if(gf8_region_impl_supported((gf8_impl_t)impl)) {
+            gf8_region_current = (gf8_impl_t)impl;
+            break;
+        }
+    }
+}
+
+int gf8_region_mul(const gf8_field_t* field, 
+    uint8_t* dst, const uint8_t* src, uint8_t c, size_t len)
+{
+    // Trivial constants don't need any tables
+    if(c == 0) {
+        for(size_t i = 0; i < len; i++) {
+            dst[i] = 0;
+        }
+        return 0;
+    }
+    if(c == 1) {
+        if(dst != src) {
+            for(size_t i = 0; i < len; i++) {
+                dst[i] = src[i];
+            }
+        }
+        return 0;
+    }
+
+    gf8_region_ops[gf8_region_current].mul(field, dst, src, c, len, 0);
+    return 0;
+}
+
+int gf8_region_mul_xor(const gf8_field_t* field, 
+    uint8_t* dst, const uint8_t* src, uint8_t c, size_t len)
+{
+    // Adding zero does nothing
+    if(c == 0) {
+        return 0;
+    }
+    if(c == 1) {
+        for(size_t i = 0; i < len; i++) {
+            dst[i] ^= src[i];
+        }
+        return 0;
+    }
+
+    gf8_region_ops[gf8_region_current].mul(field, dst, src, c, len, 1);
+    return 0;
+}
+
+int gf8_region_dot(const gf8_field_t* field, uint8_t* dst, 
+    const uint8_t* matrix, size_t stride, const uint8_t* coefficients, 
+    int rows, size_t len)
+{
+    if(rows < 0) {
+        return -1;
+    }
+    gf8_region_ops[gf8_region_current].dot(field, dst, matrix, stride, 
+        coefficients, rows, len);
+    return 0;
+}
+
+int gf8_region_syndromes(const gf8_field_t* field, 
+    uint8_t* syndromes, const uint8_t* data, size_t len, int count)
+{
+    if(count < 0) {
+        return -1;
+    }
+
+    // One kernel block of powers at a time
+    uint8_t points[GF8_REGION_SYNDROME_BLOCK];
+    for(int first = 0; first < count; first += GF8_REGION_SYNDROME_BLOCK) {
+        int lanes = count - first;
+        if(lanes > GF8_REGION_SYNDROME_BLOCK) {
+            lanes = GF8_REGION_SYNDROME_BLOCK;
+        }
+        for(int i = 0; i < lanes; i++) {
+            points[i] = field->exp[(first + i) % 0xFF];
+        }
+        gf8_region_ops[gf8_region_current].syndromes(
+            field, syndromes + first, data, len, points, lanes);
+    }
+    return 0;
+}
+
+int gf8_region_eval(const gf8_field_t* field, 
+    uint8_t* values, const uint8_t* data, size_t len, 
+    const uint8_t* points, int count)
+{
+    if(count < 0) {
+        return -1;
+    }
+    gf8_region_ops[gf8_region_current].syndromes(
+        field, values, data, len, points, count);
+    return 0;
+}
@@ -0,0 +1,707 @@
+// Generated by tools/gf8_table_gen.c, do not edit.
+// Regenerate with the gf8-tables target.
+
+#include "galois_field_8.h"
+
+const gf8_field_t gf8_field_default = {
+    .polynomial = 0x11D,
+    .generator = 0x02,
+    .exp = {
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1D, 0x3A, 0x74, 0xE8,
+        0xCD, 0x87, 0x13, 0x26, 0x4C, 0x98, 0x2D, 0x5A, 0xB4, 0x75, 0xEA, 0xC9,
+        0x8F, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x9D, 0x27, 0x4E, 0x9C,
+        0x25, 0x4A, 0x94, 0x35, 0x6A, 0xD4, 0xB5, 0x77, 0xEE, 0xC1, 0x9F, 0x23,
+        0x46, 0x8C, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0x5D, 0xBA, 0x69, 0xD2,
+        0xB9, 0x6F, 0xDE, 0xA1, 0x5F, 0xBE, 0x61, 0xC2, 0x99, 0x2F, 0x5E, 0xBC,
+        0x65, 0xCA, 0x89, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xFD, 0xE7, 0xD3, 0xBB,
+        0x6B, 0xD6, 0xB1, 0x7F, 0xFE, 0xE1, 0xDF, 0xA3, 0x5B, 0xB6, 0x71, 0xE2,
+        0xD9, 0xAF, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0D, 0x1A, 0x34, 0x68,
+        0xD0, 0xBD, 0x67, 0xCE, 0x81, 0x1F, 0x3E, 0x7C, 0xF8, 0xED, 0xC7, 0x93,
+        0x3B, 0x76, 0xEC, 0xC5, 0x97, 0x33, 0x66, 0xCC, 0x85, 0x17, 0x2E, 0x5C,
+        0xB8, 0x6D, 0xDA, 0xA9, 0x4F, 0x9E, 0x21, 0x42, 0x84, 0x15, 0x2A, 0x54,
+        0xA8, 0x4D, 0x9A, 0x29, 0x52, 0xA4, 0x55, 0xAA, 0x49, 0x92, 0x39, 0x72,
+        0xE4, 0xD5, 0xB7, 0x73, 0xE6, 0xD1, 0xBF, 0x63, 0xC6, 0x91, 0x3F, 0x7E,
+        0xFC, 0xE5, 0xD7, 0xB3, 0x7B, 0xF6, 0xF1, 0xFF, 0xE3, 0xDB, 0xAB, 0x4B,
+        0x96, 0x31, 0x62, 0xC4, 0x95, 0x37, 0x6E, 0xDC, 0xA5, 0x57, 0xAE, 0x41,
+        0x82, 0x19, 0x32, 0x64, 0xC8, 0x8D, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0,
+        0xDD, 0xA7, 0x53, 0xA6, 0x51, 0xA2, 0x59, 0xB2, 0x79, 0xF2, 0xF9, 0xEF,
+        0xC3, 0x9B, 0x2B, 0x56, 0xAC, 0x45, 0x8A, 0x09, 0x12, 0x24, 0x48, 0x90,
+        0x3D, 0x7A, 0xF4, 0xF5, 0xF7, 0xF3, 0xFB, 0xEB, 0xCB, 0x8B, 0x0B, 0x16,
+        0x2C, 0x58, 0xB0, 0x7D, 0xFA, 0xE9, 0xCF, 0x83, 0x1B, 0x36, 0x6C, 0xD8,
+        0xAD, 0x47, 0x8E, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1D,
+        0x3A, 0x74, 0xE8, 0xCD, 0x87, 0x13, 0x26, 0x4C, 0x98, 0x2D, 0x5A, 0xB4,
+        0x75, 0xEA, 0xC9, 0x8F, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x9D,
+        0x27, 0x4E, 0x9C, 0x25, 0x4A, 0x94, 0x35, 0x6A, 0xD4, 0xB5, 0x77, 0xEE,
+        0xC1, 0x9F, 0x23, 0x46, 0x8C, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0x5D,
+        0xBA, 0x69, 0xD2, 0xB9, 0x6F, 0xDE, 0xA1, 0x5F, 0xBE, 0x61, 0xC2, 0x99,
+        0x2F, 0x5E, 0xBC, 0x65, 0xCA, 0x89, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xFD,
+        0xE7, 0xD3, 0xBB, 0x6B, 0xD6, 0xB1, 0x7F, 0xFE, 0xE1, 0xDF, 0xA3, 0x5B,
+        0xB6, 0x71, 0xE2, 0xD9, 0xAF, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0D,
+        0x1A, 0x34, 0x68, 0xD0, 0xBD, 0x67, 0xCE, 0x81, 0x1F, 0x3E, 0x7C, 0xF8,
+        0xED, 0xC7, 0x93, 0x3B, 0x76, 0xEC, 0xC5, 0x97, 0x33, 0x66, 0xCC, 0x85,
+        0x17, 0x2E, 0x5C, 0xB8, 0x6D, 0xDA, 0xA9, 0x4F, 0x9E, 0x21, 0x42, 0x84,
+        0x15, 0x2A, 0x54, 0xA8, 0x4D, 0x9A, 0x29, 0x52, 0xA4, 0x55, 0xAA, 0x49,
+        0x92, 0x39, 0x72, 0xE4, 0xD5, 0xB7, 0x73, 0xE6, 0xD1, 0xBF, 0x63, 0xC6,
+        0x91, 0x3F, 0x7E, 0xFC, 0xE5, 0xD7, 0xB3, 0x7B, 0xF6, 0xF1, 0xFF, 0xE3,
+        0xDB, 0xAB, 0x4B, 0x96, 0x31, 0x62, 0xC4, 0x95, 0x37, 0x6E, 0xDC, 0xA5,
+        0x57, 0xAE, 0x41, 0x82, 0x19, 0x32, 0x64, 0xC8, 0x8D, 0x07, 0x0E, 0x1C,
+        0x38, 0x70, 0xE0, 0xDD, 0xA7, 0x53, 0xA6, 0x51, 0xA2, 0x59, 0xB2, 0x79,
+        0xF2, 0xF9, 0xEF, 0xC3, 0x9B, 0x2B, 0x56, 0xAC, 0x45, 0x8A, 0x09, 0x12,
+        0x24, 0x48, 0x90, 0x3D, 0x7A, 0xF4, 0xF5, 0xF7, 0xF3, 0xFB, 0xEB, 0xCB,
+        0x8B, 0x0B, 0x16, 0x2C, 0x58, 0xB0, 0x7D, 0xFA, 0xE9, 0xCF, 0x83, 0x1B,
+        0x36, 0x6C, 0xD8, 0xAD, 0x47, 0x8E
+    },
+    .log = {
+        0x00, 0x00, 0x01, 0x19, 0x02, 0x32, 0x1A, 0xC6, 0x03, 0xDF, 0x33, 0xEE,
+        0x1B, 0x68, 0xC7, 0x4B, 0x04, 0x64, 0xE0, 0x0E, 0x34, 0x8D, 0xEF, 0x81,
+        0x1C, 0xC1, 0x69, 0xF8, 0xC8, 0x08, 0x4C, 0x71, 0x05, 0x8A, 0x65, 0x2F,
+        0xE1, 0x24, 0x0F, 0x21, 0x35, 0x93, 0x8E, 0xDA, 0xF0, 0x12, 0x82, 0x45,
+        0x1D, 0xB5, 0xC2, 0x7D, 0x6A, 0x27, 0xF9, 0xB9, 0xC9, 0x9A, 0x09, 0x78,
+        0x4D, 0xE4, 0x72, 0xA6, 0x06, 0xBF, 0x8B, 0x62, 0x66, 0xDD, 0x30, 0xFD,
+        0xE2, 0x98, 0x25, 0xB3, 0x10, 0x91, 0x22, 0x88, 0x36, 0xD0, 0x94, 0xCE,
+        0x8F, 0x96, 0xDB, 0xBD, 0xF1, 0xD2, 0x13, 0x5C, 0x83, 0x38, 0x46, 0x40,
+        0x1E, 0x42, 0xB6, 0xA3, 0xC3, 0x48, 0x7E, 0x6E, 0x6B, 0x3A, 0x28, 0x54,
+        0xFA, 0x85, 0xBA, 0x3D, 0xCA, 0x5E, 0x9B, 0x9F, 0x0A, 0x15, 0x79, 0x2B,
+        0x4E, 0xD4, 0xE5, 0xAC, 0x73, 0xF3, 0xA7, 0x57, 0x07, 0x70, 0xC0, 0xF7,
+        0x8C, 0x80, 0x63, 0x0D, 0x67, 0x4A, 0xDE, 0xED, 0x31, 0xC5, 0xFE, 0x18,
+        0xE3, 0xA5, 0x99, 0x77, 0x26, 0xB8, 0xB4, 0x7C, 0x11, 0x44, 0x92, 0xD9,
+        0x23, 0x20, 0x89, 0x2E, 0x37, 0x3F, 0xD1, 0x5B, 0x95, 0xBC, 0xCF, 0xCD,
+        0x90, 0x87, 0x97, 0xB2, 0xDC, 0xFC, 0xBE, 0x61, 0xF2, 0x56, 0xD3, 0xAB,
+        0x14, 0x2A, 0x5D, 0x9E, 0x84, 0x3C, 0x39, 0x53, 0x47, 0x6D, 0x41, 0xA2,
+        0x1F, 0x2D, 0x43, 0xD8, 0xB7, 0x7B, 0xA4, 0x76, 0xC4, 0x17, 0x49, 0xEC,
+        0x7F, 0x0C, 0x6F, 0xF6, 0x6C, 0xA1, 0x3B, 0x52, 0x29, 0x9D, 0x55, 0xAA,
+        0xFB, 0x60, 0x86, 0xB1, 0xBB, 0xCC, 0x3E, 0x5A, 0xCB, 0x59, 0x5F, 0xB0,
+        0x9C, 0xA9, 0xA0, 0x51, 0x0B, 0xF5, 0x16, 0xEB, 0x7A, 0x75, 0x2C, 0xD7,
+        0x4F, 0xAE, 0xD5, 0xE9, 0xE6, 0xE7, 0xAD, 0xE8, 0x74, 0xD6, 0xF4, 0xEA,
+        0xA8, 0x50, 0x58, 0xAF
+    },
+    .mul_lo = {
+        {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0A,0x0B,0x0C,0x0D,0x0E,0x0F},
+        {0x00,0x02,0x04,0x06,0x08,0x0A,0x0C,0x0E,0x10,0x12,0x14,0x16,0x18,0x1A,0x1C,0x1E},
+        {0x00,0x03,0x06,0x05,0x0C,0x0F,0x0A,0x09,0x18,0x1B,0x1E,0x1D,0x14,0x17,0x12,0x11},
+        {0x00,0x04,0x08,0x0C,0x10,0x14,0x18,0x1C,0x20,0x24,0x28,0x2C,0x30,0x34,0x38,0x3C},
+        {0x00,0x05,0x0A,0x0F,0x14,0x11,0x1E,0x1B,0x28,0x2D,0x22,0x27,0x3C,0x39,0x36,0x33},
+        {0x00,0x06,0x0C,0x0A,0x18,0x1E,0x14,0x12,0x30,0x36,0x3C,0x3A,0x28,0x2E,0x24,0x22},
+        {0x00,0x07,0x0E,0x09,0x1C,0x1B,0x12,0x15,0x38,0x3F,0x36,0x31,0x24,0x23,0x2A,0x2D},
+        {0x00,0x08,0x10,0x18,0x20,0x28,0x30,0x38,0x40,0x48,0x50,0x58,0x60,0x68,0x70,0x78},
+        {0x00,0x09,0x12,0x1B,0x24,0x2D,0x36,0x3F,0x48,0x41,0x5A,0x53,0x6C,0x65,0x7E,0x77},
+        {0x00,0x0A,0x14,0x1E,0x28,0x22,0x3C,0x36,0x50,0x5A,0x44,0x4E,0x78,0x72,0x6C,0x66},
+        {0x00,0x0B,0x16,0x1D,0x2C,0x27,0x3A,0x31,0x58,0x53,0x4E,0x45,0x74,0x7F,0x62,0x69},
+        {0x00,0x0C,0x18,0x14,0x30,0x3C,0x28,0x24,0x60,0x6C,0x78,0x74,0x50,0x5C,0x48,0x44},
+        {0x00,0x0D,0x1A,0x17,0x34,0x39,0x2E,0x23,0x68,0x65,0x72,0x7F,0x5C,0x51,0x46,0x4B},
+        {0x00,0x0E,0x1C,0x12,0x38,0x36,0x24,0x2A,0x70,0x7E,0x6C,0x62,0x48,0x46,0x54,0x5A},
+        {0x00,0x0F,0x1E,0x11,0x3C,0x33,0x22,0x2D,0x78,0x77,0x66,0x69,0x44,0x4B,0x5A,0x55},
+        {0x00,0x10,0x20,0x30,0x40,0x50,0x60,0x70,0x80,0x90,0xA0,0xB0,0xC0,0xD0,0xE0,0xF0},
+        {0x00,0x11,0x22,0x33,0x44,0x55,0x66,0x77,0x88,0x99,0xAA,0xBB,0xCC,0xDD,0xEE,0xFF},
+        {0x00,0x12,0x24,0x36,0x48,0x5A,0x6C,0x7E,0x90,0x82,0xB4,0xA6,0xD8,0xCA,0xFC,0xEE},
+        {0x00,0x13,0x26,0x35,0x4C,0x5F,0x6A,0x79,0x98,0x8B,0xBE,0xAD,0xD4,0xC7,0xF2,0xE1},
+        {0x00,0x14,0x28,0x3C,0x50,0x44,0x78,0x6C,0xA0,0xB4,0x88,0x9C,0xF0,0xE4,0xD8,0xCC},
+        {0x00,0x15,0x2A,0x3F,0x54,0x41,0x7E,0x6B,0xA8,0xBD,0x82,0x97,0xFC,0xE9,0xD6,0xC3},
+        {0x00,0x16,0x2C,0x3A,0x58,0x4E,0x74,0x62,0xB0,0xA6,0x9C,0x8A,0xE8,0xFE,0xC4,0xD2},
+        {0x00,0x17,0x2E,0x39,0x5C,0x4B,0x72,0x65,0xB8,0xAF,0x96,0x81,0xE4,0xF3,0xCA,0xDD},
+        {0x00,0x18,0x30,0x28,0x60,0x78,0x50,0x48,0xC0,0xD8,0xF0,0xE8,0xA0,0xB8,0x90,0x88},
+        {0x00,0x19,0x32,0x2B,0x64,0x7D,0x56,0x4F,0xC8,0xD1,0xFA,0xE3,0xAC,0xB5,0x9E,0x87},
+        {0x00,0x1A,0x34,0x2E,0x68,0x72,0x5C,0x46,0xD0,0xCA,0xE4,0xFE,0xB8,0xA2,0x8C,0x96},
+        {0x00,0x1B,0x36,0x2D,0x6C,0x77,0x5A,0x41,0xD8,0xC3,0xEE,0xF5,0xB4,0xAF,0x82,0x99},
+        {0x00,0x1C,0x38,0x24,0x70,0x6C,0x48,0x54,0xE0,0xFC,0xD8,0xC4,0x90,0x8C,0xA8,0xB4},
+        {0x00,0x1D,0x3A,0x27,0x74,0x69,0x4E,0x53,0xE8,0xF5,0xD2,0xCF,0x9C,0x81,0xA6,0xBB},
+        {0x00,0x1E,0x3C,0x22,0x78,0x66,0x44,0x5A,0xF0,0xEE,0xCC,0xD2,0x88,0x96,0xB4,0xAA},
+        {0x00,0x1F,0x3E,0x21,0x7C,0x63,0x42,0x5D,0xF8,0xE7,0xC6,0xD9,0x84,0x9B,0xBA,0xA5},
+        {0x00,0x20,0x40,0x60,0x80,0xA0,0xC0,0xE0,0x1D,0x3D,0x5D,0x7D,0x9D,0xBD,0xDD,0xFD},
+        {0x00,0x21,0x42,0x63,0x84,0xA5,0xC6,0xE7,0x15,0x34,0x57,0x76,0x91,0xB0,0xD3,0xF2},
+        {0x00,0x22,0x44,0x66,0x88,0xAA,0xCC,0xEE,0x0D,0x2F,0x49,0x6B,0x85,0xA7,0xC1,0xE3},
+        {0x00,0x23,0x46,0x65,0x8C,0xAF,0xCA,0xE9,0x05,0x26,0x43,0x60,0x89,0xAA,0xCF,0xEC},
+        {0x00,0x24,0x48,0x6C,0x90,0xB4,0xD8,0xFC,0x3D,0x19,0x75,0x51,0xAD,0x89,0xE5,0xC1},
+        {0x00,0x25,0x4A,0x6F,0x94,0xB1,0xDE,0xFB,0x35,0x10,0x7F,0x5A,0xA1,0x84,0xEB,0xCE},
+        {0x00,0x26,0x4C,0x6A,0x98,0xBE,0xD4,0xF2,0x2D,0x0B,0x61,0x47,0xB5,0x93,0xF9,0xDF},
+        {0x00,0x27,0x4E,0x69,0x9C,0xBB,0xD2,0xF5,0x25,0x02,0x6B,0x4C,0xB9,0x9E,0xF7,0xD0},
+        {0x00,0x28,0x50,0x78,0xA0,0x88,0xF0,0xD8,0x5D,0x75,0x0D,0x25,0xFD,0xD5,0xAD,0x85},
+        {0x00,0x29,0x52,0x7B,0xA4,0x8D,0xF6,0xDF,0x55,0x7C,0x07,0x2E,0xF1,0xD8,0xA3,0x8A},
+        {0x00,0x2A,0x54,0x7E,0xA8,0x82,0xFC,0xD6,0x4D,0x67,0x19,0x33,0xE5,0xCF,0xB1,0x9B},
+        {0x00,0x2B,0x56,0x7D,0xAC,0x87,0xFA,0xD1,0x45,0x6E,0x13,0x38,0xE9,0xC2,0xBF,0x94},
+        {0x00,0x2C,0x58,0x74,0xB0,0x9C,0xE8,0xC4,0x7D,0x51,0x25,0x09,0xCD,0xE1,0x95,0xB9},
+        {0x00,0x2D,0x5A,0x77,0xB4,0x99,0xEE,0xC3,0x75,0x58,0x2F,0x02,0xC1,0xEC,0x9B,0xB6},
+        {0x00,0x2E,0x5C,0x72,0xB8,0x96,0xE4,0xCA,0x6D,0x43,0x31,0x1F,0xD5,0xFB,0x89,0xA7},
+        {0x00,0x2F,0x5E,0x71,0xBC,0x93,0xE2,0xCD,0x65,0x4A,0x3B,0x14,0xD9,0xF6,0x87,0xA8},
+        {0x00,0x30,0x60,0x50,0xC0,0xF0,0xA0,0x90,0x9D,0xAD,0xFD,0xCD,0x5D,0x6D,0x3D,0x0D},
+        {0x00,0x31,0x62,0x53,0xC4,0xF5,0xA6,0x97,0x95,0xA4,0xF7,0xC6,0x51,0x60,0x33,0x02},
+        {0x00,0x32,0x64,0x56,0xC8,0xFA,0xAC,0x9E,0x8D,0xBF,0xE9,0xDB,0x45,0x77,0x21,0x13},
+        {0x00,0x33,0x66,0x55,0xCC,0xFF,0xAA,0x99,0x85,0xB6,0xE3,0xD0,0x49,0x7A,0x2F,0x1C},
+        {0x00,0x34,0x68,0x5C,0xD0,0xE4,0xB8,0x8C,0xBD,0x89,0xD5,0xE1,0x6D,0x59,0x05,0x31},
+        {0x00,0x35,0x6A,0x5F,0xD4,0xE1,0xBE,0x8B,0xB5,0x80,0xDF,0xEA,0x61,0x54,0x0B,0x3E},
+        {0x00,0x36,0x6C,0x5A,0xD8,0xEE,0xB4,0x82,0xAD,0x9B,0xC1,0xF7,0x75,0x43,0x19,0x2F},
+        {0x00,0x37,0x6E,0x59,0xDC,0xEB,0xB2,0x85,0xA5,0x92,0xCB,0xFC,0x79,0x4E,0x17,0x20},
+        {0x00,0x38,0x70,0x48,0xE0,0xD8,0x90,0xA8,0xDD,0xE5,0xAD,0x95,0x3D,0x05,0x4D,0x75},
+        {0x00,0x39,0x72,0x4B,0xE4,0xDD,0x96,0xAF,0xD5,0xEC,0xA7,0x9E,0x31,0x08,0x43,0x7A},
+        {0x00,0x3A,0x74,0x4E,0xE8,0xD2,0x9C,0xA6,0xCD,0xF7,0xB9,0x83,0x25,0x1F,0x51,0x6B},
+        {0x00,0x3B,0x76,0x4D,0xEC,0xD7,0x9A,0xA1,0xC5,0xFE,0xB3,0x88,0x29,0x12,0x5F,0x64},
+        {0x00,0x3C,0x78,0x44,0xF0,0xCC,0x88,0xB4,0xFD,0xC1,0x85,0xB9,0x0D,0x31,0x75,0x49},
+        {0x00,0x3D,0x7A,0x47,0xF4,0xC9,0x8E,0xB3,0xF5,0xC8,0x8F,0xB2,0x01,0x3C,0x7B,0x46},
+        {0x00,0x3E,0x7C,0x42,0xF8,0xC6,0x84,0xBA,0xED,0xD3,0x91,0xAF,0x15,0x2B,0x69,0x57},
+        {0x00,0x3F,0x7E,0x41,0xFC,0xC3,0x82,0xBD,0xE5,0xDA,0x9B,0xA4,0x19,0x26,0x67,0x58},
+        {0x00,0x40,0x80,0xC0,0x1D,0x5D,0x9D,0xDD,0x3A,0x7A,0xBA,0xFA,0x27,0x67,0xA7,0xE7},
+        {0x00,0x41,0x82,0xC3,0x19,0x58,0x9B,0xDA,0x32,0x73,0xB0,0xF1,0x2B,0x6A,0xA9,0xE8},
+        {0x00,0x42,0x84,0xC6,0x15,0x57,0x91,0xD3,0x2A,0x68,0xAE,0xEC,0x3F,0x7D,0xBB,0xF9},
+        {0x00,0x43,0x86,0xC5,0x11,0x52,0x97,0xD4,0x22,0x61,0xA4,0xE7,0x33,0x70,0xB5,0xF6},
+        {0x00,0x44,0x88,0xCC,0x0D,0x49,0x85,0xC1,0x1A,0x5E,0x92,0xD6,0x17,0x53,0x9F,0xDB},
+        {0x00,0x45,0x8A,0xCF,0x09,0x4C,0x83,0xC6,0x12,0x57,0x98,0xDD,0x1B,0x5E,0x91,0xD4},
+        {0x00,0x46,0x8C,0xCA,0x05,0x43,0x89,0xCF,0x0A,0x4C,0x86,0xC0,0x0F,0x49,0x83,0xC5},
+        {0x00,0x47,0x8E,0xC9,0x01,0x46,0x8F,0xC8,0x02,0x45,0x8C,0xCB,0x03,0x44,0x8D,0xCA},
+        {0x00,0x48,0x90,0xD8,0x3D,0x75,0xAD,0xE5,0x7A,0x32,0xEA,0xA2,0x47,0x0F,0xD7,0x9F},
+        {0x00,0x49,0x92,0xDB,0x39,0x70,0xAB,0xE2,0x72,0x3B,0xE0,0xA9,0x4B,0x02,0xD9,0x90},
+        {0x00,0x4A,0x94,0xDE,0x35,0x7F,0xA1,0xEB,0x6A,0x20,0xFE,0xB4,0x5F,0x15,0xCB,0x81},
+        {0x00,0x4B,0x96,0xDD,0x31,0x7A,0xA7,0xEC,0x62,0x29,0xF4,0xBF,0x53,0x18,0xC5,0x8E},
+        {0x00,0x4C,0x98,0xD4,0x2D,0x61,0xB5,0xF9,0x5A,0x16,0xC2,0x8E,0x77,0x3B,0xEF,0xA3},
+        {0x00,0x4D,0x9A,0xD7,0x29,0x64,0xB3,0xFE,0x52,0x1F,0xC8,0x85,0x7B,0x36,0xE1,0xAC},
+        {0x00,0x4E,0x9C,0xD2,0x25,0x6B,0xB9,0xF7,0x4A,0x04,0xD6,0x98,0x6F,0x21,0xF3,0xBD},
+        {0x00,0x4F,0x9E,0xD1,0x21,0x6E,0xBF,0xF0,0x42,0x0D,0xDC,0x93,0x63,0x2C,0xFD,0xB2},
+        {0x00,0x50,0xA0,0xF0,0x5D,0x0D,0xFD,0xAD,0xBA,0xEA,0x1A,0x4A,0xE7,0xB7,0x47,0x17},
+        {0x00,0x51,0xA2,0xF3,0x59,0x08,0xFB,0xAA,0xB2,0xE3,0x10,0x41,0xEB,0xBA,0x49,0x18},
+        {0x00,0x52,0xA4,0xF6,0x55,0x07,0xF1,0xA3,0xAA,0xF8,0x0E,0x5C,0xFF,0xAD,0x5B,0x09},
+        {0x00,0x53,0xA6,0xF5,0x51,0x02,0xF7,0xA4,0xA2,0xF1,0x04,0x57,0xF3,0xA0,0x55,0x06},
+        {0x00,0x54,0xA8,0xFC,0x4D,0x19,0xE5,0xB1,0x9A,0xCE,0x32,0x66,0xD7,0x83,0x7F,0x2B},
+        {0x00,0x55,0xAA,0xFF,0x49,0x1C,0xE3,0xB6,0x92,0xC7,0x38,0x6D,0xDB,0x8E,0x71,0x24},
+        {0x00,0x56,0xAC,0xFA,0x45,0x13,0xE9,0xBF,0x8A,0xDC,0x26,0x70,0xCF,0x99,0x63,0x35},
+        {0x00,0x57,0xAE,0xF9,0x41,0x16,0xEF,0xB8,0x82,0xD5,0x2C,0x7B,0xC3,0x94,0x6D,0x3A},
+        {0x00,0x58,0xB0,0xE8,0x7D,0x25,0xCD,0x95,0xFA,0xA2,0x4A,0x12,0x87,0xDF,0x37,0x6F},
+        {0x00,0x59,0xB2,0xEB,0x79,0x20,0xCB,0x92,0xF2,0xAB,0x40,0x19,0x8B,0xD2,0x39,0x60},
+        {0x00,0x5A,0xB4,0xEE,0x75,0x2F,0xC1,0x9B,0xEA,0xB0,0x5E,0x04,0x9F,0xC5,0x2B,0x71},
+        {0x00,0x5B,0xB6,0xED,0x71,0x2A,0xC7,0x9C,0xE2,0xB9,0x54,0x0F,0x93,0xC8,0x25,0x7E},
+        {0x00,0x5C,0xB8,0xE4,0x6D,0x31,0xD5,0x89,0xDA,0x86,0x62,0x3E,0xB7,0xEB,0x0F,0x53},
+        {0x00,0x5D,0xBA,0xE7,0x69,0x34,0xD3,0x8E,0xD2,0x8F,0x68,0x35,0xBB,0xE6,0x01,0x5C},
+        {0x00,0x5E,0xBC,0xE2,0x65,0x3B,0xD9,0x87,0xCA,0x94,0x76,0x28,0xAF,0xF1,0x13,0x4D},
+        {0x00,0x5F,0xBE,0xE1,0x61,0x3E,0xDF,0x80,0xC2,0x9D,0x7C,0x23,0xA3,0xFC,0x1D,0x42},
+        {0x00,0x60,0xC0,0xA0,0x9D,0xFD,0x5D,0x3D,0x27,0x47,0xE7,0x87,0xBA,0xDA,0x7A,0x1A},
+        {0x00,0x61,0xC2,0xA3,0x99,0xF8,0x5B,0x3A,0x2F,0x4E,0xED,0x8C,0xB6,0xD7,0x74,0x15},
+        {0x00,0x62,0xC4,0xA6,0x95,0xF7,0x51,0x33,0x37,0x55,0xF3,0x91,0xA2,0xC0,0x66,0x04},
+        {0x00,0x63,0xC6,0xA5,0x91,0xF2,0x57,0x34,0x3F,0x5C,0xF9,0x9A,0xAE,0xCD,0x68,0x0B},
+        {0x00,0x64,0xC8,0xAC,0x8D,0xE9,0x45,0x21,0x07,0x63,0xCF,0xAB,0x8A,0xEE,0x42,0x26},
+        {0x00,0x65,0xCA,0xAF,0x89,0xEC,0x43,0x26,0x0F,0x6A,0xC5,0xA0,0x86,0xE3,0x4C,0x29},
+        {0x00,0x66,0xCC,0xAA,0x85,0xE3,0x49,0x2F,0x17,0x71,0xDB,0xBD,0x92,0xF4,0x5E,0x38},
+        {0x00,0x67,0xCE,0xA9,0x81,0xE6,0x4F,0x28,0x1F,0x78,0xD1,0xB6,0x9E,0xF9,0x50,0x37},
+        {0x00,0x68,0xD0,0xB8,0xBD,0xD5,0x6D,0x05,0x67,0x0F,0xB7,0xDF,0xDA,0xB2,0x0A,0x62},
+        {0x00,0x69,0xD2,0xBB,0xB9,0xD0,0x6B,0x02,0x6F,0x06,0xBD,0xD4,0xD6,0xBF,0x04,0x6D},
+        {0x00,0x6A,0xD4,0xBE,0xB5,0xDF,0x61,0x0B,0x77,0x1D,0xA3,0xC9,0xC2,0xA8,0x16,0x7C},
+        {0x00,0x6B,0xD6,0xBD,0xB1,0xDA,0x67,0x0C,0x7F,0x14,0xA9,0xC2,0xCE,0xA5,0x18,0x73},
+        {0x00,0x6C,0xD8,0xB4,0xAD,0xC1,0x75,0x19,0x47,0x2B,0x9F,0xF3,0xEA,0x86,0x32,0x5E},
+        {0x00,0x6D,0xDA,0xB7,0xA9,0xC4,0x73,0x1E,0x4F,0x22,0x95,0xF8,0xE6,0x8B,0x3C,0x51},
+        {0x00,0x6E,0xDC,0xB2,0xA5,0xCB,0x79,0x17,0x57,0x39,0x8B,0xE5,0xF2,0x9C,0x2E,0x40},
+        {0x00,0x6F,0xDE,0xB1,0xA1,0xCE,0x7F,0x10,0x5F,0x30,0x81,0xEE,0xFE,0x91,0x20,0x4F},
+        {0x00,0x70,0xE0,0x90,0xDD,0xAD,0x3D,0x4D,0xA7,0xD7,0x47,0x37,0x7A,0x0A,0x9A,0xEA},
+        {0x00,0x71,0xE2,0x93,0xD9,0xA8,0x3B,0x4A,0xAF,0xDE,0x4D,0x3C,0x76,0x07,0x94,0xE5},
+        {0x00,0x72,0xE4,0x96,0xD5,0xA7,0x31,0x43,0xB7,0xC5,0x53,0x21,0x62,0x10,0x86,0xF4},
+        {0x00,0x73,0xE6,0x95,0xD1,0xA2,0x37,0x44,0xBF,0xCC,0x59,0x2A,0x6E,0x1D,0x88,0xFB},
+        {0x00,0x74,0xE8,0x9C,0xCD,0xB9,0x25,0x51,0x87,0xF3,0x6F,0x1B,0x4A,0x3E,0xA2,0xD6},
+        {0x00,0x75,0xEA,0x9F,0xC9,0xBC,0x23,0x56,0x8F,0xFA,0x65,0x10,0x46,0x33,0xAC,0xD9},
+        {0x00,0x76,0xEC,0x9A,0xC5,0xB3,0x29,0x5F,0x97,0xE1,0x7B,0x0D,0x52,0x24,0xBE,0xC8},
+        {0x00,0x77,0xEE,0x99,0xC1,0xB6,0x2F,0x58,0x9F,0xE8,0x71,0x06,0x5E,0x29,0xB0,0xC7},
+        {0x00,0x78,0xF0,0x88,0xFD,0x85,0x0D,0x75,0xE7,0x9F,0x17,0x6F,0x1A,0x62,0xEA,0x92},
+        {0x00,0x79,0xF2,0x8B,0xF9,0x80,0x0B,0x72,0xEF,0x96,0x1D,0x64,0x16,0x6F,0xE4,0x9D},
+        {0x00,0x7A,0xF4,0x8E,0xF5,0x8F,0x01,0x7B,0xF7,0x8D,0x03,0x79,0x02,0x78,0xF6,0x8C},
+        {0x00,0x7B,0xF6,0x8D,0xF1,0x8A,0x07,0x7C,0xFF,0x84,0x09,0x72,0x0E,0x75,0xF8,0x83},
+        {0x00,0x7C,0xF8,0x84,0xED,0x91,0x15,0x69,0xC7,0xBB,0x3F,0x43,0x2A,0x56,0xD2,0xAE},
+        {0x00,0x7D,0xFA,0x87,0xE9,0x94,0x13,0x6E,0xCF,0xB2,0x35,0x48,0x26,0x5B,0xDC,0xA1},
+        {0x00,0x7E,0xFC,0x82,0xE5,0x9B,0x19,0x67,0xD7,0xA9,0x2B,0x55,0x32,0x4C,0xCE,0xB0},
+        {0x00,0x7F,0xFE,0x81,0xE1,0x9E,0x1F,0x60,0xDF,0xA0,0x21,0x5E,0x3E,0x41,0xC0,0xBF},
+        {0x00,0x80,0x1D,0x9D,0x3A,0xBA,0x27,0xA7,0x74,0xF4,0x69,0xE9,0x4E,0xCE,0x53,0xD3},
+        {0x00,0x81,0x1F,0x9E,0x3E,0xBF,0x21,0xA0,0x7C,0xFD,0x63,0xE2,0x42,0xC3,0x5D,0xDC},
+        {0x00,0x82,0x19,0x9B,0x32,0xB0,0x2B,0xA9,0x64,0xE6,0x7D,0xFF,0x56,0xD4,0x4F,0xCD},
+        {0x00,0x83,0x1B,0x98,0x36,0xB5,0x2D,0xAE,0x6C,0xEF,0x77,0xF4,0x5A,0xD9,0x41,0xC2},
+        {0x00,0x84,0x15,0x91,0x2A,0xAE,0x3F,0xBB,0x54,0xD0,0x41,0xC5,0x7E,0xFA,0x6B,0xEF},
+        {0x00,0x85,0x17,0x92,0x2E,0xAB,0x39,0xBC,0x5C,0xD9,0x4B,0xCE,0x72,0xF7,0x65,0xE0},
+        {0x00,0x86,0x11,0x97,0x22,0xA4,0x33,0xB5,0x44,0xC2,0x55,0xD3,0x66,0xE0,0x77,0xF1},
+        {0x00,0x87,0x13,0x94,0x26,0xA1,0x35,0xB2,0x4C,0xCB,0x5F,0xD8,0x6A,0xED,0x79,0xFE},
+        {0x00,0x88,0x0D,0x85,0x1A,0x92,0x17,0x9F,0x34,0xBC,0x39,0xB1,0x2E,0xA6,0x23,0xAB},
+        {0x00,0x89,0x0F,0x86,0x1E,0x97,0x11,0x98,0x3C,0xB5,0x33,0xBA,0x22,0xAB,0x2D,0xA4},
+        {0x00,0x8A,0x09,0x83,0x12,0x98,0x1B,0x91,0x24,0xAE,0x2D,0xA7,0x36,0xBC,0x3F,0xB5},
+        {0x00,0x8B,0x0B,0x80,0x16,0x9D,0x1D,0x96,0x2C,0xA7,0x27,0xAC,0x3A,0xB1,0x31,0xBA},
+        {0x00,0x8C,0x05,0x89,0x0A,0x86,0x0F,0x83,0x14,0x98,0x11,0x9D,0x1E,0x92,0x1B,0x97},
+        {0x00,0x8D,0x07,0x8A,0x0E,0x83,0x09,0x84,0x1C,0x91,0x1B,0x96,0x12,0x9F,0x15,0x98},
+        {0x00,0x8E,0x01,0x8F,0x02,0x8C,0x03,0x8D,0x04,0x8A,0x05,0x8B,0x06,0x88,0x07,0x89},
+        {0x00,0x8F,0x03,0x8C,0x06,0x89,0x05,0x8A,0x0C,0x83,0x0F,0x80,0x0A,0x85,0x09,0x86},
+        {0x00,0x90,0x3D,0xAD,0x7A,0xEA,0x47,0xD7,0xF4,0x64,0xC9,0x59,0x8E,0x1E,0xB3,0x23},
+        {0x00,0x91,0x3F,0xAE,0x7E,0xEF,0x41,0xD0,0xFC,0x6D,0xC3,0x52,0x82,0x13,0xBD,0x2C},
+        {0x00,0x92,0x39,0xAB,0x72,0xE0,0x4B,0xD9,0xE4,0x76,0xDD,0x4F,0x96,0x04,0xAF,0x3D},
+        {0x00,0x93,0x3B,0xA8,0x76,0xE5,0x4D,0xDE,0xEC,0x7F,0xD7,0x44,0x9A,0x09,0xA1,0x32},
+        {0x00,0x94,0x35,0xA1,0x6A,0xFE,0x5F,0xCB,0xD4,0x40,0xE1,0x75,0xBE,0x2A,0x8B,0x1F},
+        {0x00,0x95,0x37,0xA2,0x6E,0xFB,0x59,0xCC,0xDC,0x49,0xEB,0x7E,0xB2,0x27,0x85,0x10},
+        {0x00,0x96,0x31,0xA7,0x62,0xF4,0x53,0xC5,0xC4,0x52,0xF5,0x63,0xA6,0x30,0x97,0x01},
+        {0x00,0x97,0x33,0xA4,0x66,0xF1,0x55,0xC2,0xCC,0x5B,0xFF,0x68,0xAA,0x3D,0x99,0x0E},
+        {0x00,0x98,0x2D,0xB5,0x5A,0xC2,0x77,0xEF,0xB4,0x2C,0x99,0x01,0xEE,0x76,0xC3,0x5B},
+        {0x00,0x99,0x2F,0xB6,0x5E,0xC7,0x71,0xE8,0xBC,0x25,0x93,0x0A,0xE2,0x7B,0xCD,0x54},
+        {0x00,0x9A,0x29,0xB3,0x52,0xC8,0x7B,0xE1,0xA4,0x3E,0x8D,0x17,0xF6,0x6C,0xDF,0x45},
+        {0x00,0x9B,0x2B,0xB0,0x56,0xCD,0x7D,0xE6,0xAC,0x37,0x87,0x1C,0xFA,0x61,0xD1,0x4A},
+        {0x00,0x9C,0x25,0xB9,0x4A,0xD6,0x6F,0xF3,0x94,0x08,0xB1,0x2D,0xDE,0x42,0xFB,0x67},
+        {0x00,0x9D,0x27,0xBA,0x4E,0xD3,0x69,0xF4,0x9C,0x01,0xBB,0x26,0xD2,0x4F,0xF5,0x68},
+        {0x00,0x9E,0x21,0xBF,0x42,0xDC,0x63,0xFD,0x84,0x1A,0xA5,0x3B,0xC6,0x58,0xE7,0x79},
+        {0x00,0x9F,0x23,0xBC,0x46,0xD9,0x65,0xFA,0x8C,0x13,0xAF,0x30,0xCA,0x55,0xE9,0x76},
+        {0x00,0xA0,0x5D,0xFD,0xBA,0x1A,0xE7,0x47,0x69,0xC9,0x34,0x94,0xD3,0x73,0x8E,0x2E},
+        {0x00,0xA1,0x5F,0xFE,0xBE,0x1F,0xE1,0x40,0x61,0xC0,0x3E,0x9F,0xDF,0x7E,0x80,0x21},
+        {0x00,0xA2,0x59,0xFB,0xB2,0x10,0xEB,0x49,0x79,0xDB,0x20,0x82,0xCB,0x69,0x92,0x30},
+        {0x00,0xA3,0x5B,0xF8,0xB6,0x15,0xED,0x4E,0x71,0xD2,0x2A,0x89,0xC7,0x64,0x9C,0x3F},
+        {0x00,0xA4,0x55,0xF1,0xAA,0x0E,0xFF,0x5B,0x49,0xED,0x1C,0xB8,0xE3,0x47,0xB6,0x12},
+        {0x00,0xA5,0x57,0xF2,0xAE,0x0B,0xF9,0x5C,0x41,0xE4,0x16,0xB3,0xEF,0x4A,0xB8,0x1D},
+        {0x00,0xA6,0x51,0xF7,0xA2,0x04,0xF3,0x55,0x59,0xFF,0x08,0xAE,0xFB,0x5D,0xAA,0x0C},
+        {0x00,0xA7,0x53,0xF4,0xA6,0x01,0xF5,0x52,0x51,0xF6,0x02,0xA5,0xF7,0x50,0xA4,0x03},
+        {0x00,0xA8,0x4D,0xE5,0x9A,0x32,0xD7,0x7F,0x29,0x81,0x64,0xCC,0xB3,0x1B,0xFE,0x56},
+        {0x00,0xA9,0x4F,0xE6,0x9E,0x37,0xD1,0x78,0x21,0x88,0x6E,0xC7,0xBF,0x16,0xF0,0x59},
+        {0x00,0xAA,0x49,0xE3,0x92,0x38,0xDB,0x71,0x39,0x93,0x70,0xDA,0xAB,0x01,0xE2,0x48},
+        {0x00,0xAB,0x4B,0xE0,0x96,0x3D,0xDD,0x76,0x31,0x9A,0x7A,0xD1,0xA7,0x0C,0xEC,0x47},
+        {0x00,0xAC,0x45,0xE9,0x8A,0x26,0xCF,0x63,0x09,0xA5,0x4C,0xE0,0x83,0x2F,0xC6,0x6A},
+        {0x00,0xAD,0x47,0xEA,0x8E,0x23,0xC9,0x64,0x01,0xAC,0x46,0xEB,0x8F,0x22,0xC8,0x65},
+        {0x00,0xAE,0x41,0xEF,0x82,0x2C,0xC3,0x6D,0x19,0xB7,0x58,0xF6,0x9B,0x35,0xDA,0x74},
+        {0x00,0xAF,0x43,0xEC,0x86,0x29,0xC5,0x6A,0x11,0xBE,0x52,0xFD,0x97,0x38,0xD4,0x7B},
+        {0x00,0xB0,0x7D,0xCD,0xFA,0x4A,0x87,0x37,0xE9,0x59,0x94,0x24,0x13,0xA3,0x6E,0xDE},
+        {0x00,0xB1,0x7F,0xCE,0xFE,0x4F,0x81,0x30,0xE1,0x50,0x9E,0x2F,0x1F,0xAE,0x60,0xD1},
+        {0x00,0xB2,0x79,0xCB,0xF2,0x40,0x8B,0x39,0xF9,0x4B,0x80,0x32,0x0B,0xB9,0x72,0xC0},
+        {0x00,0xB3,0x7B,0xC8,0xF6,0x45,0x8D,0x3E,0xF1,0x42,0x8A,0x39,0x07,0xB4,0x7C,0xCF},
+        {0x00,0xB4,0x75,0xC1,0xEA,0x5E,0x9F,0x2B,0xC9,0x7D,0xBC,0x08,0x23,0x97,0x56,0xE2},
+        {0x00,0xB5,0x77,0xC2,0xEE,0x5B,0x99,0x2C,0xC1,0x74,0xB6,0x03,0x2F,0x9A,0x58,0xED},
+        {0x00,0xB6,0x71,0xC7,0xE2,0x54,0x93,0x25,0xD9,0x6F,0xA8,0x1E,0x3B,0x8D,0x4A,0xFC},
+        {0x00,0xB7,0x73,0xC4,0xE6,0x51,0x95,0x22,0xD1,0x66,0xA2,0x15,0x37,0x80,0x44,0xF3},
+        {0x00,0xB8,0x6D,0xD5,0xDA,0x62,0xB7,0x0F,0xA9,0x11,0xC4,0x7C,0x73,0xCB,0x1E,0xA6},
+        {0x00,0xB9,0x6F,0xD6,0xDE,0x67,0xB1,0x08,0xA1,0x18,0xCE,0x77,0x7F,0xC6,0x10,0xA9},
+        {0x00,0xBA,0x69,0xD3,0xD2,0x68,0xBB,0x01,0xB9,0x03,0xD0,0x6A,0x6B,0xD1,0x02,0xB8},
+        {0x00,0xBB,0x6B,0xD0,0xD6,0x6D,0xBD,0x06,0xB1,0x0A,0xDA,0x61,0x67,0xDC,0x0C,0xB7},
+        {0x00,0xBC,0x65,0xD9,0xCA,0x76,0xAF,0x13,0x89,0x35,0xEC,0x50,0x43,0xFF,0x26,0x9A},
+        {0x00,0xBD,0x67,0xDA,0xCE,0x73,0xA9,0x14,0x81,0x3C,0xE6,0x5B,0x4F,0xF2,0x28,0x95},
+        {0x00,0xBE,0x61,0xDF,0xC2,0x7C,0xA3,0x1D,0x99,0x27,0xF8,0x46,0x5B,0xE5,0x3A,0x84},
+        {0x00,0xBF,0x63,0xDC,0xC6,0x79,0xA5,0x1A,0x91,0x2E,0xF2,0x4D,0x57,0xE8,0x34,0x8B},
+        {0x00,0xC0,0x9D,0x5D,0x27,0xE7,0xBA,0x7A,0x4E,0x8E,0xD3,0x13,0x69,0xA9,0xF4,0x34},
+        {0x00,0xC1,0x9F,0x5E,0x23,0xE2,0xBC,0x7D,0x46,0x87,0xD9,0x18,0x65,0xA4,0xFA,0x3B},
+        {0x00,0xC2,0x99,0x5B,0x2F,0xED,0xB6,0x74,0x5E,0x9C,0xC7,0x05,0x71,0xB3,0xE8,0x2A},
+        {0x00,0xC3,0x9B,0x58,0x2B,0xE8,0xB0,0x73,0x56,0x95,0xCD,0x0E,0x7D,0xBE,0xE6,0x25},
+        {0x00,0xC4,0x95,0x51,0x37,0xF3,0xA2,0x66,0x6E,0xAA,0xFB,0x3F,0x59,0x9D,0xCC,0x08},
+        {0x00,0xC5,0x97,0x52,0x33,0xF6,0xA4,0x61,0x66,0xA3,0xF1,0x34,0x55,0x90,0xC2,0x07},
+        {0x00,0xC6,0x91,0x57,0x3F,0xF9,0xAE,0x68,0x7E,0xB8,0xEF,0x29,0x41,0x87,0xD0,0x16},
+        {0x00,0xC7,0x93,0x54,0x3B,0xFC,0xA8,0x6F,0x76,0xB1,0xE5,0x22,0x4D,0x8A,0xDE,0x19},
+        {0x00,0xC8,0x8D,0x45,0x07,0xCF,0x8A,0x42,0x0E,0xC6,0x83,0x4B,0x09,0xC1,0x84,0x4C},
+        {0x00,0xC9,0x8F,0x46,0x03,0xCA,0x8C,0x45,0x06,0xCF,0x89,0x40,0x05,0xCC,0x8A,0x43},
+        {0x00,0xCA,0x89,0x43,0x0F,0xC5,0x86,0x4C,0x1E,0xD4,0x97,0x5D,0x11,0xDB,0x98,0x52},
+        {0x00,0xCB,0x8B,0x40,0x0B,0xC0,0x80,0x4B,0x16,0xDD,0x9D,0x56,0x1D,0xD6,0x96,0x5D},
+        {0x00,0xCC,0x85,0x49,0x17,0xDB,0x92,0x5E,0x2E,0xE2,0xAB,0x67,0x39,0xF5,0xBC,0x70},
+        {0x00,0xCD,0x87,0x4A,0x13,0xDE,0x94,0x59,0x26,0xEB,0xA1,0x6C,0x35,0xF8,0xB2,0x7F},
+        {0x00,0xCE,0x81,0x4F,0x1F,0xD1,0x9E,0x50,0x3E,0xF0,0xBF,0x71,0x21,0xEF,0xA0,0x6E},
+        {0x00,0xCF,0x83,0x4C,0x1B,0xD4,0x98,0x57,0x36,0xF9,0xB5,0x7A,0x2D,0xE2,0xAE,0x61},
+        {0x00,0xD0,0xBD,0x6D,0x67,0xB7,0xDA,0x0A,0xCE,0x1E,0x73,0xA3,0xA9,0x79,0x14,0xC4},
+        {0x00,0xD1,0xBF,0x6E,0x63,0xB2,0xDC,0x0D,0xC6,0x17,0x79,0xA8,0xA5,0x74,0x1A,0xCB},
+        {0x00,0xD2,0xB9,0x6B,0x6F,0xBD,0xD6,0x04,0xDE,0x0C,0x67,0xB5,0xB1,0x63,0x08,0xDA},
+        {0x00,0xD3,0xBB,0x68,0x6B,0xB8,0xD0,0x03,0xD6,0x05,0x6D,0xBE,0xBD,0x6E,0x06,0xD5},
+        {0x00,0xD4,0xB5,0x61,0x77,0xA3,0xC2,0x16,0xEE,0x3A,0x5B,0x8F,0x99,0x4D,0x2C,0xF8},
+        {0x00,0xD5,0xB7,0x62,0x73,0xA6,0xC4,0x11,0xE6,0x33,0x51,0x84,0x95,0x40,0x22,0xF7},
+        {0x00,0xD6,0xB1,0x67,0x7F,0xA9,0xCE,0x18,0xFE,0x28,0x4F,0x99,0x81,0x57,0x30,0xE6},
+        {0x00,0xD7,0xB3,0x64,0x7B,0xAC,0xC8,0x1F,0xF6,0x21,0x45,0x92,0x8D,0x5A,0x3E,0xE9},
+        {0x00,0xD8,0xAD,0x75,0x47,0x9F,0xEA,0x32,0x8E,0x56,0x23,0xFB,0xC9,0x11,0x64,0xBC},
+        {0x00,0xD9,0xAF,0x76,0x43,0x9A,0xEC,0x35,0x86,0x5F,0x29,0xF0,0xC5,0x1C,0x6A,0xB3},
+        {0x00,0xDA,0xA9,0x73,0x4F,0x95,0xE6,0x3C,0x9E,0x44,0x37,0xED,0xD1,0x0B,0x78,0xA2},
+        {0x00,0xDB,0xAB,0x70,0x4B,0x90,0xE0,0x3B,0x96,0x4D,0x3D,0xE6,0xDD,0x06,0x76,0xAD},
+        {0x00,0xDC,0xA5,0x79,0x57,0x8B,0xF2,0x2E,0xAE,0x72,0x0B,0xD7,0xF9,0x25,0x5C,0x80},
+        {0x00,0xDD,0xA7,0x7A,0x53,0x8E,0xF4,0x29,0xA6,0x7B,0x01,0xDC,0xF5,0x28,0x52,0x8F},
+        {0x00,0xDE,0xA1,0x7F,0x5F,0x81,0xFE,0x20,0xBE,0x60,0x1F,0xC1,0xE1,0x3F,0x40,0x9E},
+        {0x00,0xDF,0xA3,0x7C,0x5B,0x84,0xF8,0x27,0xB6,0x69,0x15,0xCA,0xED,0x32,0x4E,0x91},
+        {0x00,0xE0,0xDD,0x3D,0xA7,0x47,0x7A,0x9A,0x53,0xB3,0x8E,0x6E,0xF4,0x14,0x29,0xC9},
+        {0x00,0xE1,0xDF,0x3E,0xA3,0x42,0x7C,0x9D,0x5B,0xBA,0x84,0x65,0xF8,0x19,0x27,0xC6},
+        {0x00,0xE2,0xD9,0x3B,0xAF,0x4D,0x76,0x94,0x43,0xA1,0x9A,0x78,0xEC,0x0E,0x35,0xD7},
+        {0x00,0xE3,0xDB,0x38,0xAB,0x48,0x70,0x93,0x4B,0xA8,0x90,0x73,0xE0,0x03,0x3B,0xD8},
+        {0x00,0xE4,0xD5,0x31,0xB7,0x53,0x62,0x86,0x73,0x97,0xA6,0x42,0xC4,0x20,0x11,0xF5},
+        {0x00,0xE5,0xD7,0x32,0xB3,0x56,0x64,0x81,0x7B,0x9E,0xAC,0x49,0xC8,0x2D,0x1F,0xFA},
+        {0x00,0xE6,0xD1,0x37,0xBF,0x59,0x6E,0x88,0x63,0x85,0xB2,0x54,0xDC,0x3A,0x0D,0xEB},
+        {0x00,0xE7,0xD3,0x34,0xBB,0x5C,0x68,0x8F,0x6B,0x8C,0xB8,0x5F,0xD0,0x37,0x03,0xE4},
+        {0x00,0xE8,0xCD,0x25,0x87,0x6F,0x4A,0xA2,0x13,0xFB,0xDE,0x36,0x94,0x7C,0x59,0xB1},
+        {0x00,0xE9,0xCF,0x26,0x83,0x6A,0x4C,0xA5,0x1B,0xF2,0xD4,0x3D,0x98,0x71,0x57,0xBE},
+        {0x00,0xEA,0xC9,0x23,0x8F,0x65,0x46,0xAC,0x03,0xE9,0xCA,0x20,0x8C,0x66,0x45,0xAF},
+        {0x00,0xEB,0xCB,0x20,0x8B,0x60,0x40,0xAB,0x0B,0xE0,0xC0,0x2B,0x80,0x6B,0x4B,0xA0},
+        {0x00,0xEC,0xC5,0x29,0x97,0x7B,0x52,0xBE,0x33,0xDF,0xF6,0x1A,0xA4,0x48,0x61,0x8D},
+        {0x00,0xED,0xC7,0x2A,0x93,0x7E,0x54,0xB9,0x3B,0xD6,0xFC,0x11,0xA8,0x45,0x6F,0x82},
+        {0x00,0xEE,0xC1,0x2F,0x9F,0x71,0x5E,0xB0,0x23,0xCD,0xE2,0x0C,0xBC,0x52,0x7D,0x93},
+        {0x00,0xEF,0xC3,0x2C,0x9B,0x74,0x58,0xB7,0x2B,0xC4,0xE8,0x07,0xB0,0x5F,0x73,0x9C},
+        {0x00,0xF0,0xFD,0x0D,0xE7,0x17,0x1A,0xEA,0xD3,0x23,0x2E,0xDE,0x34,0xC4,0xC9,0x39},
+        {0x00,0xF1,0xFF,0x0E,0xE3,0x12,0x1C,0xED,0xDB,0x2A,0x24,0xD5,0x38,0xC9,0xC7,0x36},
+        {0x00,0xF2,0xF9,0x0B,0xEF,0x1D,0x16,0xE4,0xC3,0x31,0x3A,0xC8,0x2C,0xDE,0xD5,0x27},
+        {0x00,0xF3,0xFB,0x08,0xEB,0x18,0x10,0xE3,0xCB,0x38,0x30,0xC3,0x20,0xD3,0xDB,0x28},
+        {0x00,0xF4,0xF5,0x01,0xF7,0x03,0x02,0xF6,0xF3,0x07,0x06,0xF2,0x04,0xF0,0xF1,0x05},
+        {0x00,0xF5,0xF7,0x02,0xF3,0x06,0x04,0xF1,0xFB,0x0E,0x0C,0xF9,0x08,0xFD,0xFF,0x0A},
+        {0x00,0xF6,0xF1,0x07,0xFF,0x09,0x0E,0xF8,0xE3,0x15,0x12,0xE4,0x1C,0xEA,0xED,0x1B},
+        {0x00,0xF7,0xF3,0x04,0xFB,0x0C,0x08,0xFF,0xEB,0x1C,0x18,0xEF,0x10,0xE7,0xE3,0x14},
+        {0x00,0xF8,0xED,0x15,0xC7,0x3F,0x2A,0xD2,0x93,0x6B,0x7E,0x86,0x54,0xAC,0xB9,0x41},
+        {0x00,0xF9,0xEF,0x16,0xC3,0x3A,0x2C,0xD5,0x9B,0x62,0x74,0x8D,0x58,0xA1,0xB7,0x4E},
+        {0x00,0xFA,0xE9,0x13,0xCF,0x35,0x26,0xDC,0x83,0x79,0x6A,0x90,0x4C,0xB6,0xA5,0x5F},
+        {0x00,0xFB,0xEB,0x10,0xCB,0x30,0x20,0xDB,0x8B,0x70,0x60,0x9B,0x40,0xBB,0xAB,0x50},
+        {0x00,0xFC,0xE5,0x19,0xD7,0x2B,0x32,0xCE,0xB3,0x4F,0x56,0xAA,0x64,0x98,0x81,0x7D},
+        {0x00,0xFD,0xE7,0x1A,0xD3,0x2E,0x34,0xC9,0xBB,0x46,0x5C,0xA1,0x68,0x95,0x8F,0x72},
+        {0x00,0xFE,0xE1,0x1F,0xDF,0x21,0x3E,0xC0,0xA3,0x5D,0x42,0xBC,0x7C,0x82,0x9D,0x63},
+        {0x00,0xFF,0xE3,0x1C,0xDB,0x24,0x38,0xC7,0xAB,0x54,0x48,0xB7,0x70,0x8F,0x93,0x6C}
+    },
+    .mul_hi = {
+        {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x10,0x20,0x30,0x40,0x50,0x60,0x70,0x80,0x90,0xA0,0xB0,0xC0,0xD0,0xE0,0xF0},
+        {0x00,0x20,0x40,0x60,0x80,0xA0,0xC0,0xE0,0x1D,0x3D,0x5D,0x7D,0x9D,0xBD,0xDD,0xFD},
+        {0x00,0x30,0x60,0x50,0xC0,0xF0,0xA0,0x90,0x9D,0xAD,0xFD,0xCD,0x5D,0x6D,0x3D,0x0D},
+        {0x00,0x40,0x80,0xC0,0x1D,0x5D,0x9D,0xDD,0x3A,0x7A,0xBA,0xFA,0x27,0x67,0xA7,0xE7},
+        {0x00,0x50,0xA0,0xF0,0x5D,0x0D,0xFD,0xAD,0xBA,0xEA,0x1A,0x4A,0xE7,0xB7,0x47,0x17},
+        {0x00,0x60,0xC0,0xA0,0x9D,0xFD,0x5D,0x3D,0x27,0x47,0xE7,0x87,0xBA,0xDA,0x7A,0x1A},
+        {0x00,0x70,0xE0,0x90,0xDD,0xAD,0x3D,0x4D,0xA7,0xD7,0x47,0x37,0x7A,0x0A,0x9A,0xEA},
+        {0x00,0x80,0x1D,0x9D,0x3A,0xBA,0x27,0xA7,0x74,0xF4,0x69,0xE9,0x4E,0xCE,0x53,0xD3},
+        {0x00,0x90,0x3D,0xAD,0x7A,0xEA,0x47,0xD7,0xF4,0x64,0xC9,0x59,0x8E,0x1E,0xB3,0x23},
+        {0x00,0xA0,0x5D,0xFD,0xBA,0x1A,0xE7,0x47,0x69,0xC9,0x34,0x94,0xD3,0x73,0x8E,0x2E},
+        {0x00,0xB0,0x7D,0xCD,0xFA,0x4A,0x87,0x37,0xE9,0x59,0x94,0x24,0x13,0xA3,0x6E,0xDE},
+        {0x00,0xC0,0x9D,0x5D,0x27,0xE7,0xBA,0x7A,0x4E,0x8E,0xD3,0x13,0x69,0xA9,0xF4,0x34},
+        {0x00,0xD0,0xBD,0x6D,0x67,0xB7,0xDA,0x0A,0xCE,0x1E,0x73,0xA3,0xA9,0x79,0x14,0xC4},
+        {0x00,0xE0,0xDD,0x3D,0xA7,0x47,0x7A,0x9A,0x53,0xB3,0x8E,0x6E,0xF4,0x14,0x29,0xC9},
+        {0x00,0xF0,0xFD,0x0D,0xE7,0x17,0x1A,0xEA,0xD3,0x23,0x2E,0xDE,0x34,0xC4,0xC9,0x39},
+        {0x00,0x1D,0x3A,0x27,0x74,0x69,0x4E,0x53,0xE8,0xF5,0xD2,0xCF,0x9C,0x81,0xA6,0xBB},
+        {0x00,0x0D,0x1A,0x17,0x34,0x39,0x2E,0x23,0x68,0x65,0x72,0x7F,0x5C,0x51,0x46,0x4B},
+        {0x00,0x3D,0x7A,0x47,0xF4,0xC9,0x8E,0xB3,0xF5,0xC8,0x8F,0xB2,0x01,0x3C,0x7B,0x46},
+        {0x00,0x2D,0x5A,0x77,0xB4,0x99,0xEE,0xC3,0x75,0x58,0x2F,0x02,0xC1,0xEC,0x9B,0xB6},
+        {0x00,0x5D,0xBA,0xE7,0x69,0x34,0xD3,0x8E,0xD2,0x8F,0x68,0x35,0xBB,0xE6,0x01,0x5C},
+        {0x00,0x4D,0x9A,0xD7,0x29,0x64,0xB3,0xFE,0x52,0x1F,0xC8,0x85,0x7B,0x36,0xE1,0xAC},
+        {0x00,0x7D,0xFA,0x87,0xE9,0x94,0x13,0x6E,0xCF,0xB2,0x35,0x48,0x26,0x5B,0xDC,0xA1},
+        {0x00,0x6D,0xDA,0xB7,0xA9,0xC4,0x73,0x1E,0x4F,0x22,0x95,0xF8,0xE6,0x8B,0x3C,0x51},
+        {0x00,0x9D,0x27,0xBA,0x4E,0xD3,0x69,0xF4,0x9C,0x01,0xBB,0x26,0xD2,0x4F,0xF5,0x68},
+        {0x00,0x8D,0x07,0x8A,0x0E,0x83,0x09,0x84,0x1C,0x91,0x1B,0x96,0x12,0x9F,0x15,0x98},
+        {0x00,0xBD,0x67,0xDA,0xCE,0x73,0xA9,0x14,0x81,0x3C,0xE6,0x5B,0x4F,0xF2,0x28,0x95},
+        {0x00,0xAD,0x47,0xEA,0x8E,0x23,0xC9,0x64,0x01,0xAC,0x46,0xEB,0x8F,0x22,0xC8,0x65},
+        {0x00,0xDD,0xA7,0x7A,0x53,0x8E,0xF4,0x29,0xA6,0x7B,0x01,0xDC,0xF5,0x28,0x52,0x8F},
+        {0x00,0xCD,0x87,0x4A,0x13,0xDE,0x94,0x59,0x26,0xEB,0xA1,0x6C,0x35,0xF8,0xB2,0x7F},
+        {0x00,0xFD,0xE7,0x1A,0xD3,0x2E,0x34,0xC9,0xBB,0x46,0x5C,0xA1,0x68,0x95,0x8F,0x72},
+        {0x00,0xED,0xC7,0x2A,0x93,0x7E,0x54,0xB9,0x3B,0xD6,0xFC,0x11,0xA8,0x45,0x6F,0x82},
+        {0x00,0x3A,0x74,0x4E,0xE8,0xD2,0x9C,0xA6,0xCD,0xF7,0xB9,0x83,0x25,0x1F,0x51,0x6B},
+        {0x00,0x2A,0x54,0x7E,0xA8,0x82,0xFC,0xD6,0x4D,0x67,0x19,0x33,0xE5,0xCF,0xB1,0x9B},
+        {0x00,0x1A,0x34,0x2E,0x68,0x72,0x5C,0x46,0xD0,0xCA,0xE4,0xFE,0xB8,0xA2,0x8C,0x96},
+        {0x00,0x0A,0x14,0x1E,0x28,0x22,0x3C,0x36,0x50,0x5A,0x44,0x4E,0x78,0x72,0x6C,0x66},
+        {0x00,0x7A,0xF4,0x8E,0xF5,0x8F,0x01,0x7B,0xF7,0x8D,0x03,0x79,0x02,0x78,0xF6,0x8C},
+        {0x00,0x6A,0xD4,0xBE,0xB5,0xDF,0x61,0x0B,0x77,0x1D,0xA3,0xC9,0xC2,0xA8,0x16,0x7C},
+        {0x00,0x5A,0xB4,0xEE,0x75,0x2F,0xC1,0x9B,0xEA,0xB0,0x5E,0x04,0x9F,0xC5,0x2B,0x71},
+        {0x00,0x4A,0x94,0xDE,0x35,0x7F,0xA1,0xEB,0x6A,0x20,0xFE,0xB4,0x5F,0x15,0xCB,0x81},
+        {0x00,0xBA,0x69,0xD3,0xD2,0x68,0xBB,0x01,0xB9,0x03,0xD0,0x6A,0x6B,0xD1,0x02,0xB8},
+        {0x00,0xAA,0x49,0xE3,0x92,0x38,0xDB,0x71,0x39,0x93,0x70,0xDA,0xAB,0x01,0xE2,0x48},
+        {0x00,0x9A,0x29,0xB3,0x52,0xC8,0x7B,0xE1,0xA4,0x3E,0x8D,0x17,0xF6,0x6C,0xDF,0x45},
+        {0x00,0x8A,0x09,0x83,0x12,0x98,0x1B,0x91,0x24,0xAE,0x2D,0xA7,0x36,0xBC,0x3F,0xB5},
+        {0x00,0xFA,0xE9,0x13,0xCF,0x35,0x26,0xDC,0x83,0x79,0x6A,0x90,0x4C,0xB6,0xA5,0x5F},
+        {0x00,0xEA,0xC9,0x23,0x8F,0x65,0x46,0xAC,0x03,0xE9,0xCA,0x20,0x8C,0x66,0x45,0xAF},
+        {0x00,0xDA,0xA9,0x73,0x4F,0x95,0xE6,0x3C,0x9E,0x44,0x37,0xED,0xD1,0x0B,0x78,0xA2},
+        {0x00,0xCA,0x89,0x43,0x0F,0xC5,0x86,0x4C,0x1E,0xD4,0x97,0x5D,0x11,0xDB,0x98,0x52},
+        {0x00,0x27,0x4E,0x69,0x9C,0xBB,0xD2,0xF5,0x25,0x02,0x6B,0x4C,0xB9,0x9E,0xF7,0xD0},
+        {0x00,0x37,0x6E,0x59,0xDC,0xEB,0xB2,0x85,0xA5,0x92,0xCB,0xFC,0x79,0x4E,0x17,0x20},
+        {0x00,0x07,0x0E,0x09,0x1C,0x1B,0x12,0x15,0x38,0x3F,0x36,0x31,0x24,0x23,0x2A,0x2D},
+        {0x00,0x17,0x2E,0x39,0x5C,0x4B,0x72,0x65,0xB8,0xAF,0x96,0x81,0xE4,0xF3,0xCA,0xDD},
+        {0x00,0x67,0xCE,0xA9,0x81,0xE6,0x4F,0x28,0x1F,0x78,0xD1,0xB6,0x9E,0xF9,0x50,0x37},
+        {0x00,0x77,0xEE,0x99,0xC1,0xB6,0x2F,0x58,0x9F,0xE8,0x71,0x06,0x5E,0x29,0xB0,0xC7},
+        {0x00,0x47,0x8E,0xC9,0x01,0x46,0x8F,0xC8,0x02,0x45,0x8C,0xCB,0x03,0x44,0x8D,0xCA},
+        {0x00,0x57,0xAE,0xF9,0x41,0x16,0xEF,0xB8,0x82,0xD5,0x2C,0x7B,0xC3,0x94,0x6D,0x3A},
+        {0x00,0xA7,0x53,0xF4,0xA6,0x01,0xF5,0x52,0x51,0xF6,0x02,0xA5,0xF7,0x50,0xA4,0x03},
+        {0x00,0xB7,0x73,0xC4,0xE6,0x51,0x95,0x22,0xD1,0x66,0xA2,0x15,0x37,0x80,0x44,0xF3},
+        {0x00,0x87,0x13,0x94,0x26,0xA1,0x35,0xB2,0x4C,0xCB,0x5F,0xD8,0x6A,0xED,0x79,0xFE},
+        {0x00,0x97,0x33,0xA4,0x66,0xF1,0x55,0xC2,0xCC,0x5B,0xFF,0x68,0xAA,0x3D,0x99,0x0E},
+        {0x00,0xE7,0xD3,0x34,0xBB,0x5C,0x68,0x8F,0x6B,0x8C,0xB8,0x5F,0xD0,0x37,0x03,0xE4},
+        {0x00,0xF7,0xF3,0x04,0xFB,0x0C,0x08,0xFF,0xEB,0x1C,0x18,0xEF,0x10,0xE7,0xE3,0x14},
+        {0x00,0xC7,0x93,0x54,0x3B,0xFC,0xA8,0x6F,0x76,0xB1,0xE5,0x22,0x4D,0x8A,0xDE,0x19},
+        {0x00,0xD7,0xB3,0x64,0x7B,0xAC,0xC8,0x1F,0xF6,0x21,0x45,0x92,0x8D,0x5A,0x3E,0xE9},
+        {0x00,0x74,0xE8,0x9C,0xCD,0xB9,0x25,0x51,0x87,0xF3,0x6F,0x1B,0x4A,0x3E,0xA2,0xD6},
+        {0x00,0x64,0xC8,0xAC,0x8D,0xE9,0x45,0x21,0x07,0x63,0xCF,0xAB,0x8A,0xEE,0x42,0x26},
+        {0x00,0x54,0xA8,0xFC,0x4D,0x19,0xE5,0xB1,0x9A,0xCE,0x32,0x66,0xD7,0x83,0x7F,0x2B},
+        {0x00,0x44,0x88,0xCC,0x0D,0x49,0x85,0xC1,0x1A,0x5E,0x92,0xD6,0x17,0x53,0x9F,0xDB},
+        {0x00,0x34,0x68,0x5C,0xD0,0xE4,0xB8,0x8C,0xBD,0x89,0xD5,0xE1,0x6D,0x59,0x05,0x31},
+        {0x00,0x24,0x48,0x6C,0x90,0xB4,0xD8,0xFC,0x3D,0x19,0x75,0x51,0xAD,0x89,0xE5,0xC1},
+        {0x00,0x14,0x28,0x3C,0x50,0x44,0x78,0x6C,0xA0,0xB4,0x88,0x9C,0xF0,0xE4,0xD8,0xCC},
+        {0x00,0x04,0x08,0x0C,0x10,0x14,0x18,0x1C,0x20,0x24,0x28,0x2C,0x30,0x34,0x38,0x3C},
+        {0x00,0xF4,0xF5,0x01,0xF7,0x03,0x02,0xF6,0xF3,0x07,0x06,0xF2,0x04,0xF0,0xF1,0x05},
+        {0x00,0xE4,0xD5,0x31,0xB7,0x53,0x62,0x86,0x73,0x97,0xA6,0x42,0xC4,0x20,0x11,0xF5},
+        {0x00,0xD4,0xB5,0x61,0x77,0xA3,0xC2,0x16,0xEE,0x3A,0x5B,0x8F,0x99,0x4D,0x2C,0xF8},
+        {0x00,0xC4,0x95,0x51,0x37,0xF3,0xA2,0x66,0x6E,0xAA,0xFB,0x3F,0x59,0x9D,0xCC,0x08},
+        {0x00,0xB4,0x75,0xC1,0xEA,0x5E,0x9F,0x2B,0xC9,0x7D,0xBC,0x08,0x23,0x97,0x56,0xE2},
+        {0x00,0xA4,0x55,0xF1,0xAA,0x0E,0xFF,0x5B,0x49,0xED,0x1C,0xB8,0xE3,0x47,0xB6,0x12},
+        {0x00,0x94,0x35,0xA1,0x6A,0xFE,0x5F,0xCB,0xD4,0x40,0xE1,0x75,0xBE,0x2A,0x8B,0x1F},
+        {0x00,0x84,0x15,0x91,0x2A,0xAE,0x3F,0xBB,0x54,0xD0,0x41,0xC5,0x7E,0xFA,0x6B,0xEF},
+        {0x00,0x69,0xD2,0xBB,0xB9,0xD0,0x6B,0x02,0x6F,0x06,0xBD,0xD4,0xD6,0xBF,0x04,0x6D},
+        {0x00,0x79,0xF2,0x8B,0xF9,0x80,0x0B,0x72,0xEF,0x96,0x1D,0x64,0x16,0x6F,0xE4,0x9D},
+        {0x00,0x49,0x92,0xDB,0x39,0x70,0xAB,0xE2,0x72,0x3B,0xE0,0xA9,0x4B,0x02,0xD9,0x90},
+        {0x00,0x59,0xB2,0xEB,0x79,0x20,0xCB,0x92,0xF2,0xAB,0x40,0x19,0x8B,0xD2,0x39,0x60},
+        {0x00,0x29,0x52,0x7B,0xA4,0x8D,0xF6,0xDF,0x55,0x7C,0x07,0x2E,0xF1,0xD8,0xA3,0x8A},
+        {0x00,0x39,0x72,0x4B,0xE4,0xDD,0x96,0xAF,0xD5,0xEC,0xA7,0x9E,0x31,0x08,0x43,0x7A},
+        {0x00,0x09,0x12,0x1B,0x24,0x2D,0x36,0x3F,0x48,0x41,0x5A,0x53,0x6C,0x65,0x7E,0x77},
+        {0x00,0x19,0x32,0x2B,0x64,0x7D,0x56,0x4F,0xC8,0xD1,0xFA,0xE3,0xAC,0xB5,0x9E,0x87},
+        {0x00,0xE9,0xCF,0x26,0x83,0x6A,0x4C,0xA5,0x1B,0xF2,0xD4,0x3D,0x98,0x71,0x57,0xBE},
+        {0x00,0xF9,0xEF,0x16,0xC3,0x3A,0x2C,0xD5,0x9B,0x62,0x74,0x8D,0x58,0xA1,0xB7,0x4E},
+        {0x00,0xC9,0x8F,0x46,0x03,0xCA,0x8C,0x45,0x06,0xCF,0x89,0x40,0x05,0xCC,0x8A,0x43},
+        {0x00,0xD9,0xAF,0x76,0x43,0x9A,0xEC,0x35,0x86,0x5F,0x29,0xF0,0xC5,0x1C,0x6A,0xB3},
+        {0x00,0xA9,0x4F,0xE6,0x9E,0x37,0xD1,0x78,0x21,0x88,0x6E,0xC7,0xBF,0x16,0xF0,0x59},
+        {0x00,0xB9,0x6F,0xD6,0xDE,0x67,0xB1,0x08,0xA1,0x18,0xCE,0x77,0x7F,0xC6,0x10,0xA9},
+        {0x00,0x89,0x0F,0x86,0x1E,0x97,0x11,0x98,0x3C,0xB5,0x33,0xBA,0x22,0xAB,0x2D,0xA4},
+        {0x00,0x99,0x2F,0xB6,0x5E,0xC7,0x71,0xE8,0xBC,0x25,0x93,0x0A,0xE2,0x7B,0xCD,0x54},
+        {0x00,0x4E,0x9C,0xD2,0x25,0x6B,0xB9,0xF7,0x4A,0x04,0xD6,0x98,0x6F,0x21,0xF3,0xBD},
+        {0x00,0x5E,0xBC,0xE2,0x65,0x3B,0xD9,0x87,0xCA,0x94,0x76,0x28,0xAF,0xF1,0x13,0x4D},
+        {0x00,0x6E,0xDC,0xB2,0xA5,0xCB,0x79,0x17,0x57,0x39,0x8B,0xE5,0xF2,0x9C,0x2E,0x40},
+        {0x00,0x7E,0xFC,0x82,0xE5,0x9B,0x19,0x67,0xD7,0xA9,0x2B,0x55,0x32,0x4C,0xCE,0xB0},
+        {0x00,0x0E,0x1C,0x12,0x38,0x36,0x24,0x2A,0x70,0x7E,0x6C,0x62,0x48,0x46,0x54,0x5A},
+        {0x00,0x1E,0x3C,0x22,0x78,0x66,0x44,0x5A,0xF0,0xEE,0xCC,0xD2,0x88,0x96,0xB4,0xAA},
+        {0x00,0x2E,0x5C,0x72,0xB8,0x96,0xE4,0xCA,0x6D,0x43,0x31,0x1F,0xD5,0xFB,0x89,0xA7},
+        {0x00,0x3E,0x7C,0x42,0xF8,0xC6,0x84,0xBA,0xED,0xD3,0x91,0xAF,0x15,0x2B,0x69,0x57},
+        {0x00,0xCE,0x81,0x4F,0x1F,0xD1,0x9E,0x50,0x3E,0xF0,0xBF,0x71,0x21,0xEF,0xA0,0x6E},
+        {0x00,0xDE,0xA1,0x7F,0x5F,0x81,0xFE,0x20,0xBE,0x60,0x1F,0xC1,0xE1,0x3F,0x40,0x9E},
+        {0x00,0xEE,0xC1,0x2F,0x9F,0x71,0x5E,0xB0,0x23,0xCD,0xE2,0x0C,0xBC,0x52,0x7D,0x93},
+        {0x00,0xFE,0xE1,0x1F,0xDF,0x21,0x3E,0xC0,0xA3,0x5D,0x42,0xBC,0x7C,0x82,0x9D,0x63},
+        {0x00,0x8E,0x01,0x8F,0x02,0x8C,0x03,0x8D,0x04,0x8A,0x05,0x8B,0x06,0x88,0x07,0x89},
+        {0x00,0x9E,0x21,0xBF,0x42,0xDC,0x63,0xFD,0x84,0x1A,0xA5,0x3B,0xC6,0x58,0xE7,0x79},
+        {0x00,0xAE,0x41,0xEF,0x82,0x2C,0xC3,0x6D,0x19,0xB7,0x58,0xF6,0x9B,0x35,0xDA,0x74},
+        {0x00,0xBE,0x61,0xDF,0xC2,0x7C,0xA3,0x1D,0x99,0x27,0xF8,0x46,0x5B,0xE5,0x3A,0x84},
+        {0x00,0x53,0xA6,0xF5,0x51,0x02,0xF7,0xA4,0xA2,0xF1,0x04,0x57,0xF3,0xA0,0x55,0x06},
+        {0x00,0x43,0x86,0xC5,0x11,0x52,0x97,0xD4,0x22,0x61,0xA4,0xE7,0x33,0x70,0xB5,0xF6},
+        {0x00,0x73,0xE6,0x95,0xD1,0xA2,0x37,0x44,0xBF,0xCC,0x59,0x2A,0x6E,0x1D,0x88,0xFB},
+        {0x00,0x63,0xC6,0xA5,0x91,0xF2,0x57,0x34,0x3F,0x5C,0xF9,0x9A,0xAE,0xCD,0x68,0x0B},
+        {0x00,0x13,0x26,0x35,0x4C,0x5F,0x6A,0x79,0x98,0x8B,0xBE,0xAD,0xD4,0xC7,0xF2,0xE1},
+        {0x00,0x03,0x06,0x05,0x0C,0x0F,0x0A,0x09,0x18,0x1B,0x1E,0x1D,0x14,0x17,0x12,0x11},
+        {0x00,0x33,0x66,0x55,0xCC,0xFF,0xAA,0x99,0x85,0xB6,0xE3,0xD0,0x49,0x7A,0x2F,0x1C},
+        {0x00,0x23,0x46,0x65,0x8C,0xAF,0xCA,0xE9,0x05,0x26,0x43,0x60,0x89,0xAA,0xCF,0xEC},
+        {0x00,0xD3,0xBB,0x68,0x6B,0xB8,0xD0,0x03,0xD6,0x05,0x6D,0xBE,0xBD,0x6E,0x06,0xD5},
+        {0x00,0xC3,0x9B,0x58,0x2B,0xE8,0xB0,0x73,0x56,0x95,0xCD,0x0E,0x7D,0xBE,0xE6,0x25},
+        {0x00,0xF3,0xFB,0x08,0xEB,0x18,0x10,0xE3,0xCB,0x38,0x30,0xC3,0x20,0xD3,0xDB,0x28},
+        {0x00,0xE3,0xDB,0x38,0xAB,0x48,0x70,0x93,0x4B,0xA8,0x90,0x73,0xE0,0x03,0x3B,0xD8},
+        {0x00,0x93,0x3B,0xA8,0x76,0xE5,0x4D,0xDE,0xEC,0x7F,0xD7,0x44,0x9A,0x09,0xA1,0x32},
+        {0x00,0x83,0x1B,0x98,0x36,0xB5,0x2D,0xAE,0x6C,0xEF,0x77,0xF4,0x5A,0xD9,0x41,0xC2},
+        {0x00,0xB3,0x7B,0xC8,0xF6,0x45,0x8D,0x3E,0xF1,0x42,0x8A,0x39,0x07,0xB4,0x7C,0xCF},
+        {0x00,0xA3,0x5B,0xF8,0xB6,0x15,0xED,0x4E,0x71,0xD2,0x2A,0x89,0xC7,0x64,0x9C,0x3F},
+        {0x00,0xE8,0xCD,0x25,0x87,0x6F,0x4A,0xA2,0x13,0xFB,0xDE,0x36,0x94,0x7C,0x59,0xB1},
+        {0x00,0xF8,0xED,0x15,0xC7,0x3F,0x2A,0xD2,0x93,0x6B,0x7E,0x86,0x54,0xAC,0xB9,0x41},
+        {0x00,0xC8,0x8D,0x45,0x07,0xCF,0x8A,0x42,0x0E,0xC6,0x83,0x4B,0x09,0xC1,0x84,0x4C},
+        {0x00,0xD8,0xAD,0x75,0x47,0x9F,0xEA,0x32,0x8E,0x56,0x23,0xFB,0xC9,0x11,0x64,0xBC},
+        {0x00,0xA8,0x4D,0xE5,0x9A,0x32,0xD7,0x7F,0x29,0x81,0x64,0xCC,0xB3,0x1B,0xFE,0x56},
+        {0x00,0xB8,0x6D,0xD5,0xDA,0x62,0xB7,0x0F,0xA9,0x11,0xC4,0x7C,0x73,0xCB,0x1E,0xA6},
+        {0x00,0x88,0x0D,0x85,0x1A,0x92,0x17,0x9F,0x34,0xBC,0x39,0xB1,0x2E,0xA6,0x23,0xAB},
+        {0x00,0x98,0x2D,0xB5,0x5A,0xC2,0x77,0xEF,0xB4,0x2C,0x99,0x01,0xEE,0x76,0xC3,0x5B},
+        {0x00,0x68,0xD0,0xB8,0xBD,0xD5,0x6D,0x05,0x67,0x0F,0xB7,0xDF,0xDA,0xB2,0x0A,0x62},
+        {0x00,0x78,0xF0,0x88,0xFD,0x85,0x0D,0x75,0xE7,0x9F,0x17,0x6F,0x1A,0x62,0xEA,0x92},
+        {0x00,0x48,0x90,0xD8,0x3D,0x75,0xAD,0xE5,0x7A,0x32,0xEA,0xA2,0x47,0x0F,0xD7,0x9F},
+        {0x00,0x58,0xB0,0xE8,0x7D,0x25,0xCD,0x95,0xFA,0xA2,0x4A,0x12,0x87,0xDF,0x37,0x6F},
+        {0x00,0x28,0x50,0x78,0xA0,0x88,0xF0,0xD8,0x5D,0x75,0x0D,0x25,0xFD,0xD5,0xAD,0x85},
+        {0x00,0x38,0x70,0x48,0xE0,0xD8,0x90,0xA8,0xDD,0xE5,0xAD,0x95,0x3D,0x05,0x4D,0x75},
+        {0x00,0x08,0x10,0x18,0x20,0x28,0x30,0x38,0x40,0x48,0x50,0x58,0x60,0x68,0x70,0x78},
+        {0x00,0x18,0x30,0x28,0x60,0x78,0x50,0x48,0xC0,0xD8,0xF0,0xE8,0xA0,0xB8,0x90,0x88},
+        {0x00,0xF5,0xF7,0x02,0xF3,0x06,0x04,0xF1,0xFB,0x0E,0x0C,0xF9,0x08,0xFD,0xFF,0x0A},
+        {0x00,0xE5,0xD7,0x32,0xB3,0x56,0x64,0x81,0x7B,0x9E,0xAC,0x49,0xC8,0x2D,0x1F,0xFA},
+        {0x00,0xD5,0xB7,0x62,0x73,0xA6,0xC4,0x11,0xE6,0x33,0x51,0x84,0x95,0x40,0x22,0xF7},
+        {0x00,0xC5,0x97,0x52,0x33,0xF6,0xA4,0x61,0x66,0xA3,0xF1,0x34,0x55,0x90,0xC2,0x07},
+        {0x00,0xB5,0x77,0xC2,0xEE,0x5B,0x99,0x2C,0xC1,0x74,0xB6,0x03,0x2F,0x9A,0x58,0xED},
+        {0x00,0xA5,0x57,0xF2,0xAE,0x0B,0xF9,0x5C,0x41,0xE4,0x16,0xB3,0xEF,0x4A,0xB8,0x1D},
+        {0x00,0x95,0x37,0xA2,0x6E,0xFB,0x59,0xCC,0xDC,0x49,0xEB,0x7E,0xB2,0x27,0x85,0x10},
+        {0x00,0x85,0x17,0x92,0x2E,0xAB,0x39,0xBC,0x5C,0xD9,0x4B,0xCE,0x72,0xF7,0x65,0xE0},
+        {0x00,0x75,0xEA,0x9F,0xC9,0xBC,0x23,0x56,0x8F,0xFA,0x65,0x10,0x46,0x33,0xAC,0xD9},
+        {0x00,0x65,0xCA,0xAF,0x89,0xEC,0x43,0x26,0x0F,0x6A,0xC5,0xA0,0x86,0xE3,0x4C,0x29},
+        {0x00,0x55,0xAA,0xFF,0x49,0x1C,0xE3,0xB6,0x92,0xC7,0x38,0x6D,0xDB,0x8E,0x71,0x24},
+        {0x00,0x45,0x8A,0xCF,0x09,0x4C,0x83,0xC6,0x12,0x57,0x98,0xDD,0x1B,0x5E,0x91,0xD4},
+        {0x00,0x35,0x6A,0x5F,0xD4,0xE1,0xBE,0x8B,0xB5,0x80,0xDF,0xEA,0x61,0x54,0x0B,0x3E},
+        {0x00,0x25,0x4A,0x6F,0x94,0xB1,0xDE,0xFB,0x35,0x10,0x7F,0x5A,0xA1,0x84,0xEB,0xCE},
+        {0x00,0x15,0x2A,0x3F,0x54,0x41,0x7E,0x6B,0xA8,0xBD,0x82,0x97,0xFC,0xE9,0xD6,0xC3},
+        {0x00,0x05,0x0A,0x0F,0x14,0x11,0x1E,0x1B,0x28,0x2D,0x22,0x27,0x3C,0x39,0x36,0x33},
+        {0x00,0xD2,0xB9,0x6B,0x6F,0xBD,0xD6,0x04,0xDE,0x0C,0x67,0xB5,0xB1,0x63,0x08,0xDA},
+        {0x00,0xC2,0x99,0x5B,0x2F,0xED,0xB6,0x74,0x5E,0x9C,0xC7,0x05,0x71,0xB3,0xE8,0x2A},
+        {0x00,0xF2,0xF9,0x0B,0xEF,0x1D,0x16,0xE4,0xC3,0x31,0x3A,0xC8,0x2C,0xDE,0xD5,0x27},
+        {0x00,0xE2,0xD9,0x3B,0xAF,0x4D,0x76,0x94,0x43,0xA1,0x9A,0x78,0xEC,0x0E,0x35,0xD7},
+        {0x00,0x92,0x39,0xAB,0x72,0xE0,0x4B,0xD9,0xE4,0x76,0xDD,0x4F,0x96,0x04,0xAF,0x3D},
+        {0x00,0x82,0x19,0x9B,0x32,0xB0,0x2B,0xA9,0x64,0xE6,0x7D,0xFF,0x56,0xD4,0x4F,0xCD},
+        {0x00,0xB2,0x79,0xCB,0xF2,0x40,0x8B,0x39,0xF9,0x4B,0x80,0x32,0x0B,0xB9,0x72,0xC0},
+        {0x00,0xA2,0x59,0xFB,0xB2,0x10,0xEB,0x49,0x79,0xDB,0x20,0x82,0xCB,0x69,0x92,0x30},
+        {0x00,0x52,0xA4,0xF6,0x55,0x07,0xF1,0xA3,0xAA,0xF8,0x0E,0x5C,0xFF,0xAD,0x5B,0x09},
+        {0x00,0x42,0x84,0xC6,0x15,0x57,0x91,0xD3,0x2A,0x68,0xAE,0xEC,0x3F,0x7D,0xBB,0xF9},
+        {0x00,0x72,0xE4,0x96,0xD5,0xA7,0x31,0x43,0xB7,0xC5,0x53,0x21,0x62,0x10,0x86,0xF4},
+        {0x00,0x62,0xC4,0xA6,0x95,0xF7,0x51,0x33,0x37,0x55,0xF3,0x91,0xA2,0xC0,0x66,0x04},
+        {0x00,0x12,0x24,0x36,0x48,0x5A,0x6C,0x7E,0x90,0x82,0xB4,0xA6,0xD8,0xCA,0xFC,0xEE},
+        {0x00,0x02,0x04,0x06,0x08,0x0A,0x0C,0x0E,0x10,0x12,0x14,0x16,0x18,0x1A,0x1C,0x1E},
+        {0x00,0x32,0x64,0x56,0xC8,0xFA,0xAC,0x9E,0x8D,0xBF,0xE9,0xDB,0x45,0x77,0x21,0x13},
+        {0x00,0x22,0x44,0x66,0x88,0xAA,0xCC,0xEE,0x0D,0x2F,0x49,0x6B,0x85,0xA7,0xC1,0xE3},
+        {0x00,0xCF,0x83,0x4C,0x1B,0xD4,0x98,0x57,0x36,0xF9,0xB5,0x7A,0x2D,0xE2,0xAE,0x61},
+        {0x00,0xDF,0xA3,0x7C,0x5B,0x84,0xF8,0x27,0xB6,0x69,0x15,0xCA,0xED,0x32,0x4E,0x91},
+        {0x00,0xEF,0xC3,0x2C,0x9B,0x74,0x58,0xB7,0x2B,0xC4,0xE8,0x07,0xB0,0x5F,0x73,0x9C},
+        {0x00,0xFF,0xE3,0x1C,0xDB,0x24,0x38,0xC7,0xAB,0x54,0x48,0xB7,0x70,0x8F,0x93,0x6C},
+        {0x00,0x8F,0x03,0x8C,0x06,0x89,0x05,0x8A,0x0C,0x83,0x0F,0x80,0x0A,0x85,0x09,0x86},
+        {0x00,0x9F,0x23,0xBC,0x46,0xD9,0x65,0xFA,0x8C,0x13,0xAF,0x30,0xCA,0x55,0xE9,0x76},
+        {0x00,0xAF,0x43,0xEC,0x86,0x29,0xC5,0x6A,0x11,0xBE,0x52,0xFD,0x97,0x38,0xD4,0x7B},
+        {0x00,0xBF,0x63,0xDC,0xC6,0x79,0xA5,0x1A,0x91,0x2E,0xF2,0x4D,0x57,0xE8,0x34,0x8B},
+        {0x00,0x4F,0x9E,0xD1,0x21,0x6E,0xBF,0xF0,0x42,0x0D,0xDC,0x93,0x63,0x2C,0xFD,0xB2},
+        {0x00,0x5F,0xBE,0xE1,0x61,0x3E,0xDF,0x80,0xC2,0x9D,0x7C,0x23,0xA3,0xFC,0x1D,0x42},
+        {0x00,0x6F,0xDE,0xB1,0xA1,0xCE,0x7F,0x10,0x5F,0x30,0x81,0xEE,0xFE,0x91,0x20,0x4F},
+        {0x00,0x7F,0xFE,0x81,0xE1,0x9E,0x1F,0x60,0xDF,0xA0,0x21,0x5E,0x3E,0x41,0xC0,0xBF},
+        {0x00,0x0F,0x1E,0x11,0x3C,0x33,0x22,0x2D,0x78,0x77,0x66,0x69,0x44,0x4B,0x5A,0x55},
+        {0x00,0x1F,0x3E,0x21,0x7C,0x63,0x42,0x5D,0xF8,0xE7,0xC6,0xD9,0x84,0x9B,0xBA,0xA5},
+        {0x00,0x2F,0x5E,0x71,0xBC,0x93,0xE2,0xCD,0x65,0x4A,0x3B,0x14,0xD9,0xF6,0x87,0xA8},
+        {0x00,0x3F,0x7E,0x41,0xFC,0xC3,0x82,0xBD,0xE5,0xDA,0x9B,0xA4,0x19,0x26,0x67,0x58},
+        {0x00,0x9C,0x25,0xB9,0x4A,0xD6,0x6F,0xF3,0x94,0x08,0xB1,0x2D,0xDE,0x42,0xFB,0x67},
+        {0x00,0x8C,0x05,0x89,0x0A,0x86,0x0F,0x83,0x14,0x98,0x11,0x9D,0x1E,0x92,0x1B,0x97},
+        {0x00,0xBC,0x65,0xD9,0xCA,0x76,0xAF,0x13,0x89,0x35,0xEC,0x50,0x43,0xFF,0x26,0x9A},
+        {0x00,0xAC,0x45,0xE9,0x8A,0x26,0xCF,0x63,0x09,0xA5,0x4C,0xE0,0x83,0x2F,0xC6,0x6A},
+        {0x00,0xDC,0xA5,0x79,0x57,0x8B,0xF2,0x2E,0xAE,0x72,0x0B,0xD7,0xF9,0x25,0x5C,0x80},
+        {0x00,0xCC,0x85,0x49,0x17,0xDB,0x92,0x5E,0x2E,0xE2,0xAB,0x67,0x39,0xF5,0xBC,0x70},
+        {0x00,0xFC,0xE5,0x19,0xD7,0x2B,0x32,0xCE,0xB3,0x4F,0x56,0xAA,0x64,0x98,0x81,0x7D},
+        {0x00,0xEC,0xC5,0x29,0x97,0x7B,0x52,0xBE,0x33,0xDF,0xF6,0x1A,0xA4,0x48,0x61,0x8D},
+        {0x00,0x1C,0x38,0x24,0x70,0x6C,0x48,0x54,0xE0,0xFC,0xD8,0xC4,0x90,0x8C,0xA8,0xB4},
+        {0x00,0x0C,0x18,0x14,0x30,0x3C,0x28,0x24,0x60,0x6C,0x78,0x74,0x50,0x5C,0x48,0x44},
+        {0x00,0x3C,0x78,0x44,0xF0,0xCC,0x88,0xB4,0xFD,0xC1,0x85,0xB9,0x0D,0x31,0x75,0x49},
+        {0x00,0x2C,0x58,0x74,0xB0,0x9C,0xE8,0xC4,0x7D,0x51,0x25,0x09,0xCD,0xE1,0x95,0xB9},
+        {0x00,0x5C,0xB8,0xE4,0x6D,0x31,0xD5,0x89,0xDA,0x86,0x62,0x3E,0xB7,0xEB,0x0F,0x53},
+        {0x00,0x4C,0x98,0xD4,0x2D,0x61,0xB5,0xF9,0x5A,0x16,0xC2,0x8E,0x77,0x3B,0xEF,0xA3},
+        {0x00,0x7C,0xF8,0x84,0xED,0x91,0x15,0x69,0xC7,0xBB,0x3F,0x43,0x2A,0x56,0xD2,0xAE},
+        {0x00,0x6C,0xD8,0xB4,0xAD,0xC1,0x75,0x19,0x47,0x2B,0x9F,0xF3,0xEA,0x86,0x32,0x5E},
+        {0x00,0x81,0x1F,0x9E,0x3E,0xBF,0x21,0xA0,0x7C,0xFD,0x63,0xE2,0x42,0xC3,0x5D,0xDC},
+        {0x00,0x91,0x3F,0xAE,0x7E,0xEF,0x41,0xD0,0xFC,0x6D,0xC3,0x52,0x82,0x13,0xBD,0x2C},
+        {0x00,0xA1,0x5F,0xFE,0xBE,0x1F,0xE1,0x40,0x61,0xC0,0x3E,0x9F,0xDF,0x7E,0x80,0x21},
+        {0x00,0xB1,0x7F,0xCE,0xFE,0x4F,0x81,0x30,0xE1,0x50,0x9E,0x2F,0x1F,0xAE,0x60,0xD1},
+        {0x00,0xC1,0x9F,0x5E,0x23,0xE2,0xBC,0x7D,0x46,0x87,0xD9,0x18,0x65,0xA4,0xFA,0x3B},
+        {0x00,0xD1,0xBF,0x6E,0x63,0xB2,0xDC,0x0D,0xC6,0x17,0x79,0xA8,0xA5,0x74,0x1A,0xCB},
+        {0x00,0xE1,0xDF,0x3E,0xA3,0x42,0x7C,0x9D,0x5B,0xBA,0x84,0x65,0xF8,0x19,0x27,0xC6},
+        {0x00,0xF1,0xFF,0x0E,0xE3,0x12,0x1C,0xED,0xDB,0x2A,0x24,0xD5,0x38,0xC9,0xC7,0x36},
+        {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0A,0x0B,0x0C,0x0D,0x0E,0x0F},
+        {0x00,0x11,0x22,0x33,0x44,0x55,0x66,0x77,0x88,0x99,0xAA,0xBB,0xCC,0xDD,0xEE,0xFF},
+        {0x00,0x21,0x42,0x63,0x84,0xA5,0xC6,0xE7,0x15,0x34,0x57,0x76,0x91,0xB0,0xD3,0xF2},
+        {0x00,0x31,0x62,0x53,0xC4,0xF5,0xA6,0x97,0x95,0xA4,0xF7,0xC6,0x51,0x60,0x33,0x02},
+        {0x00,0x41,0x82,0xC3,0x19,0x58,0x9B,0xDA,0x32,0x73,0xB0,0xF1,0x2B,0x6A,0xA9,0xE8},
+        {0x00,0x51,0xA2,0xF3,0x59,0x08,0xFB,0xAA,0xB2,0xE3,0x10,0x41,0xEB,0xBA,0x49,0x18},
+        {0x00,0x61,0xC2,0xA3,0x99,0xF8,0x5B,0x3A,0x2F,0x4E,0xED,0x8C,0xB6,0xD7,0x74,0x15},
+        {0x00,0x71,0xE2,0x93,0xD9,0xA8,0x3B,0x4A,0xAF,0xDE,0x4D,0x3C,0x76,0x07,0x94,0xE5},
+        {0x00,0xA6,0x51,0xF7,0xA2,0x04,0xF3,0x55,0x59,0xFF,0x08,0xAE,0xFB,0x5D,0xAA,0x0C},
+        {0x00,0xB6,0x71,0xC7,0xE2,0x54,0x93,0x25,0xD9,0x6F,0xA8,0x1E,0x3B,0x8D,0x4A,0xFC},
+        {0x00,0x86,0x11,0x97,0x22,0xA4,0x33,0xB5,0x44,0xC2,0x55,0xD3,0x66,0xE0,0x77,0xF1},
+        {0x00,0x96,0x31,0xA7,0x62,0xF4,0x53,0xC5,0xC4,0x52,0xF5,0x63,0xA6,0x30,0x97,0x01},
+        {0x00,0xE6,0xD1,0x37,0xBF,0x59,0x6E,0x88,0x63,0x85,0xB2,0x54,0xDC,0x3A,0x0D,0xEB},
+        {0x00,0xF6,0xF1,0x07,0xFF,0x09,0x0E,0xF8,0xE3,0x15,0x12,0xE4,0x1C,0xEA,0xED,0x1B},
+        {0x00,0xC6,0x91,0x57,0x3F,0xF9,0xAE,0x68,0x7E,0xB8,0xEF,0x29,0x41,0x87,0xD0,0x16},
+        {0x00,0xD6,0xB1,0x67,0x7F,0xA9,0xCE,0x18,0xFE,0x28,0x4F,0x99,0x81,0x57,0x30,0xE6},
+        {0x00,0x26,0x4C,0x6A,0x98,0xBE,0xD4,0xF2,0x2D,0x0B,0x61,0x47,0xB5,0x93,0xF9,0xDF},
+        {0x00,0x36,0x6C,0x5A,0xD8,0xEE,0xB4,0x82,0xAD,0x9B,0xC1,0xF7,0x75,0x43,0x19,0x2F},
+        {0x00,0x06,0x0C,0x0A,0x18,0x1E,0x14,0x12,0x30,0x36,0x3C,0x3A,0x28,0x2E,0x24,0x22},
+        {0x00,0x16,0x2C,0x3A,0x58,0x4E,0x74,0x62,0xB0,0xA6,0x9C,0x8A,0xE8,0xFE,0xC4,0xD2},
+        {0x00,0x66,0xCC,0xAA,0x85,0xE3,0x49,0x2F,0x17,0x71,0xDB,0xBD,0x92,0xF4,0x5E,0x38},
+        {0x00,0x76,0xEC,0x9A,0xC5,0xB3,0x29,0x5F,0x97,0xE1,0x7B,0x0D,0x52,0x24,0xBE,0xC8},
+        {0x00,0x46,0x8C,0xCA,0x05,0x43,0x89,0xCF,0x0A,0x4C,0x86,0xC0,0x0F,0x49,0x83,0xC5},
+        {0x00,0x56,0xAC,0xFA,0x45,0x13,0xE9,0xBF,0x8A,0xDC,0x26,0x70,0xCF,0x99,0x63,0x35},
+        {0x00,0xBB,0x6B,0xD0,0xD6,0x6D,0xBD,0x06,0xB1,0x0A,0xDA,0x61,0x67,0xDC,0x0C,0xB7},
+        {0x00,0xAB,0x4B,0xE0,0x96,0x3D,0xDD,0x76,0x31,0x9A,0x7A,0xD1,0xA7,0x0C,0xEC,0x47},
+        {0x00,0x9B,0x2B,0xB0,0x56,0xCD,0x7D,0xE6,0xAC,0x37,0x87,0x1C,0xFA,0x61,0xD1,0x4A},
+        {0x00,0x8B,0x0B,0x80,0x16,0x9D,0x1D,0x96,0x2C,0xA7,0x27,0xAC,0x3A,0xB1,0x31,0xBA},
+        {0x00,0xFB,0xEB,0x10,0xCB,0x30,0x20,0xDB,0x8B,0x70,0x60,0x9B,0x40,0xBB,0xAB,0x50},
+        {0x00,0xEB,0xCB,0x20,0x8B,0x60,0x40,0xAB,0x0B,0xE0,0xC0,0x2B,0x80,0x6B,0x4B,0xA0},
+        {0x00,0xDB,0xAB,0x70,0x4B,0x90,0xE0,0x3B,0x96,0x4D,0x3D,0xE6,0xDD,0x06,0x76,0xAD},
+        {0x00,0xCB,0x8B,0x40,0x0B,0xC0,0x80,0x4B,0x16,0xDD,0x9D,0x56,0x1D,0xD6,0x96,0x5D},
+        {0x00,0x3B,0x76,0x4D,0xEC,0xD7,0x9A,0xA1,0xC5,0xFE,0xB3,0x88,0x29,0x12,0x5F,0x64},
+        {0x00,0x2B,0x56,0x7D,0xAC,0x87,0xFA,0xD1,0x45,0x6E,0x13,0x38,0xE9,0xC2,0xBF,0x94},
+        {0x00,0x1B,0x36,0x2D,0x6C,0x77,0x5A,0x41,0xD8,0xC3,0xEE,0xF5,0xB4,0xAF,0x82,0x99},
+        {0x00,0x0B,0x16,0x1D,0x2C,0x27,0x3A,0x31,0x58,0x53,0x4E,0x45,0x74,0x7F,0x62,0x69},
+        {0x00,0x7B,0xF6,0x8D,0xF1,0x8A,0x07,0x7C,0xFF,0x84,0x09,0x72,0x0E,0x75,0xF8,0x83},
+        {0x00,0x6B,0xD6,0xBD,0xB1,0xDA,0x67,0x0C,0x7F,0x14,0xA9,0xC2,0xCE,0xA5,0x18,0x73},
+        {0x00,0x5B,0xB6,0xED,0x71,0x2A,0xC7,0x9C,0xE2,0xB9,0x54,0x0F,0x93,0xC8,0x25,0x7E},
+        {0x00,0x4B,0x96,0xDD,0x31,0x7A,0xA7,0xEC,0x62,0x29,0xF4,0xBF,0x53,0x18,0xC5,0x8E}
+    },
+    .affine = {
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x8001828488102040ULL,
+        0x8103868C983060C0ULL, 0x408041C2C4881020ULL, 0x418245CAD4A850A0ULL,
+        0xC081C3464C983060ULL, 0xC183C74E5CB870E0ULL, 0x2040A061E2C48810ULL,
+        0x2142A469F2E4C890ULL, 0xA04122E56AD4A850ULL, 0xA14326ED7AF4E8D0ULL,
+        0x60C0E1A3264C9830ULL, 0x61C2E5AB366CD8B0ULL, 0xE0C16327AE5CB870ULL,
+        0xE1C3672FBE7CF8F0ULL, 0x102050B071E2C488ULL, 0x112254B861C28408ULL,
+        0x9021D234F9F2E4C8ULL, 0x9123D63CE9D2A448ULL, 0x50A01172B56AD4A8ULL,
+        0x51A2157AA54A9428ULL, 0xD0A193F63D7AF4E8ULL, 0xD1A397FE2D5AB468ULL,
+        0x3060F0D193264C98ULL, 0x3162F4D983060C18ULL, 0xB06172551B366CD8ULL,
+        0xB163765D0B162C58ULL, 0x70E0B11357AE5CB8ULL, 0x71E2B51B478E1C38ULL,
+        0xF0E13397DFBE7CF8ULL, 0xF1E3379FCF9E3C78ULL, 0x8810A8D83871E2C4ULL,
+        0x8912ACD02851A244ULL, 0x08112A5CB061C284ULL, 0x09132E54A0418204ULL,
+        0xC890E91AFCF9F2E4ULL, 0xC992ED12ECD9B264ULL, 0x48916B9E74E9D2A4ULL,
+        0x49936F9664C99224ULL, 0xA85008B9DAB56AD4ULL, 0xA9520CB1CA952A54ULL,
+        0x28518A3D52A54A94ULL, 0x29538E3542850A14ULL, 0xE8D0497B1E3D7AF4ULL,
+        0xE9D24D730E1D3A74ULL, 0x68D1CBFF962D5AB4ULL, 0x69D3CFF7860D1A34ULL,
+        0x9830F8684993264CULL, 0x9932FC6059B366CCULL, 0x18317AECC183060CULL,
+        0x19337EE4D1A3468CULL, 0xD8B0B9AA8D1B366CULL, 0xD9B2BDA29D3B76ECULL,
+        0x58B13B2E050B162CULL, 0x59B33F26152B56ACULL, 0xB8705809AB57AE5CULL,
+        0xB9725C01BB77EEDCULL, 0x3871DA8D23478E1CULL, 0x3973DE853367CE9CULL,
+        0xF8F019CB6FDFBE7CULL, 0xF9F21DC37FFFFEFCULL, 0x78F19B4FE7CF9E3CULL,
+        0x79F39F47F7EFDEBCULL, 0xC488D46C1C3871E2ULL, 0xC58AD0640C183162ULL,
+        0x448956E8942851A2ULL, 0x458B52E084081122ULL, 0x840895AED8B061C2ULL,
+        0x850A91A6C8902142ULL, 0x0409172A50A04182ULL, 0x050B132240800102ULL,
+        0xE4C8740DFEFCF9F2ULL, 0xE5CA7005EEDCB972ULL, 0x64C9F68976ECD9B2ULL,
+        0x65CBF28166CC9932ULL, 0xA44835CF3A74E9D2ULL, 0xA54A31C72A54A952ULL,
+        0x2449B74BB264C992ULL, 0x254BB343A2448912ULL, 0xD4A884DC6DDAB56AULL,
+        0xD5AA80D47DFAF5EAULL, 0x54A90658E5CA952AULL, 0x55AB0250F5EAD5AAULL,
+        0x9428C51EA952A54AULL, 0x952AC116B972E5CAULL, 0x1429479A2142850AULL,
+        0x152B43923162C58AULL, 0xF4E824BD8F1E3D7AULL, 0xF5EA20B59F3E7DFAULL,
+        0x74E9A639070E1D3AULL, 0x75EBA231172E5DBAULL, 0xB468657F4B962D5AULL,
+        0xB56A61775BB66DDAULL, 0x3469E7FBC3860D1AULL, 0x356BE3F3D3A64D9AULL,
+        0x4C987CB424499326ULL, 0x4D9A78BC3469D3A6ULL, 0xCC99FE30AC59B366ULL,
+        0xCD9BFA38BC79F3E6ULL, 0x0C183D76E0C18306ULL, 0x0D1A397EF0E1C386ULL,
+        0x8C19BFF268D1A346ULL, 0x8D1BBBFA78F1E3C6ULL, 0x6CD8DCD5C68D1B36ULL,
+        0x6DDAD8DDD6AD5BB6ULL, 0xECD95E514E9D3B76ULL, 0xEDDB5A595EBD7BF6ULL,
+        0x2C589D1702050B16ULL, 0x2D5A991F12254B96ULL, 0xAC591F938A152B56ULL,
+        0xAD5B1B9B9A356BD6ULL, 0x5CB82C0455AB57AEULL, 0x5DBA280C458B172EULL,
+        0xDCB9AE80DDBB77EEULL, 0xDDBBAA88CD9B376EULL, 0x1C386DC69123478EULL,
+        0x1D3A69CE8103070EULL, 0x9C39EF42193367CEULL, 0x9D3BEB4A0913274EULL,
+        0x7CF88C65B76FDFBEULL, 0x7DFA886DA74F9F3EULL, 0xFCF90EE13F7FFFFEULL,
+        0xFDFB0AE92F5FBF7EULL, 0x3C78CDA773E7CF9EULL, 0x3D7AC9AF63C78F1EULL,
+        0xBC794F23FBF7EFDEULL, 0xBD7B4B2BEBD7AF5EULL, 0xE2C46A368E1C3871ULL,
+        0xE3C66E3E9E3C78F1ULL, 0x62C5E8B2060C1831ULL, 0x63C7ECBA162C58B1ULL,
+        0xA2442BF44A942851ULL, 0xA3462FFC5AB468D1ULL, 0x2245A970C2840811ULL,
+        0x2347AD78D2A44891ULL, 0xC284CA576CD8B061ULL, 0xC386CE5F7CF8F0E1ULL,
+        0x428548D3E4C89021ULL, 0x43874CDBF4E8D0A1ULL, 0x82048B95A850A041ULL,
+        0x83068F9DB870E0C1ULL, 0x0205091120408001ULL, 0x03070D193060C081ULL,
+        0xF2E43A86FFFEFCF9ULL, 0xF3E63E8EEFDEBC79ULL, 0x72E5B80277EEDCB9ULL,
+        0x73E7BC0A67CE9C39ULL, 0xB2647B443B76ECD9ULL, 0xB3667F4C2B56AC59ULL,
+        0x3265F9C0B366CC99ULL, 0x3367FDC8A3468C19ULL, 0xD2A49AE71D3A74E9ULL,
+        0xD3A69EEF0D1A3469ULL, 0x52A51863952A54A9ULL, 0x53A71C6B850A1429ULL,
+        0x9224DB25D9B264C9ULL, 0x9326DF2DC9922449ULL, 0x122559A151A24489ULL,
+        0x13275DA941820409ULL, 0x6AD4C2EEB66DDAB5ULL, 0x6BD6C6E6A64D9A35ULL,
+        0xEAD5406A3E7DFAF5ULL, 0xEBD744622E5DBA75ULL, 0x2A54832C72E5CA95ULL,
+        0x2B56872462C58A15ULL, 0xAA5501A8FAF5EAD5ULL, 0xAB5705A0EAD5AA55ULL,
+        0x4A94628F54A952A5ULL, 0x4B96668744891225ULL, 0xCA95E00BDCB972E5ULL,
+        0xCB97E403CC993265ULL, 0x0A14234D90214285ULL, 0x0B16274580010205ULL,
+        0x8A15A1C9183162C5ULL, 0x8B17A5C108112245ULL, 0x7AF4925EC78F1E3DULL,
+        0x7BF69656D7AF5EBDULL, 0xFAF510DA4F9F3E7DULL, 0xFBF714D25FBF7EFDULL,
+        0x3A74D39C03070E1DULL, 0x3B76D79413274E9DULL, 0xBA7551188B172E5DULL,
+        0xBB7755109B376EDDULL, 0x5AB4323F254B962DULL, 0x5BB63637356BD6ADULL,
+        0xDAB5B0BBAD5BB66DULL, 0xDBB7B4B3BD7BF6EDULL, 0x1A3473FDE1C3860DULL,
+        0x1B3677F5F1E3C68DULL, 0x9A35F17969D3A64DULL, 0x9B37F57179F3E6CDULL,
+        0x264CBE5A92244993ULL, 0x274EBA5282040913ULL, 0xA64D3CDE1A3469D3ULL,
+        0xA74F38D60A142953ULL, 0x66CCFF9856AC59B3ULL, 0x67CEFB90468C1933ULL,
+        0xE6CD7D1CDEBC79F3ULL, 0xE7CF7914CE9C3973ULL, 0x060C1E3B70E0C183ULL,
+        0x070E1A3360C08103ULL, 0x860D9CBFF8F0E1C3ULL, 0x870F98B7E8D0A143ULL,
+        0x468C5FF9B468D1A3ULL, 0x478E5BF1A4489123ULL, 0xC68DDD7D3C78F1E3ULL,
+        0xC78FD9752C58B163ULL, 0x366CEEEAE3C68D1BULL, 0x376EEAE2F3E6CD9BULL,
+        0xB66D6C6E6BD6AD5BULL, 0xB76F68667BF6EDDBULL, 0x76ECAF28274E9D3BULL,
+        0x77EEAB20376EDDBBULL, 0xF6ED2DACAF5EBD7BULL, 0xF7EF29A4BF7EFDFBULL,
+        0x162C4E8B0102050BULL, 0x172E4A831122458BULL, 0x962DCC0F8912254BULL,
+        0x972FC807993265CBULL, 0x56AC0F49C58A152BULL, 0x57AE0B41D5AA55ABULL,
+        0xD6AD8DCD4D9A356BULL, 0xD7AF89C55DBA75EBULL, 0xAE5C1682AA55AB57ULL,
+        0xAF5E128ABA75EBD7ULL, 0x2E5D940622458B17ULL, 0x2F5F900E3265CB97ULL,
+        0xEEDC57406EDDBB77ULL, 0xEFDE53487EFDFBF7ULL, 0x6EDDD5C4E6CD9B37ULL,
+        0x6FDFD1CCF6EDDBB7ULL, 0x8E1CB6E348912347ULL, 0x8F1EB2EB58B163C7ULL,
+        0x0E1D3467C0810307ULL, 0x0F1F306FD0A14387ULL, 0xCE9CF7218C193367ULL,
+        0xCF9EF3299C3973E7ULL, 0x4E9D75A504091327ULL, 0x4F9F71AD142953A7ULL,
+        0xBE7C4632DBB76FDFULL, 0xBF7E423ACB972F5FULL, 0x3E7DC4B653A74F9FULL,
+        0x3F7FC0BE43870F1FULL, 0xFEFC07F01F3F7FFFULL, 0xFFFE03F80F1F3F7FULL,
+        0x7EFD8574972F5FBFULL, 0x7FFF817C870F1F3FULL, 0x9E3CE6533973E7CFULL,
+        0x9F3EE25B2953A74FULL, 0x1E3D64D7B163C78FULL, 0x1F3F60DFA143870FULL,
+        0xDEBCA791FDFBF7EFULL, 0xDFBEA399EDDBB76FULL, 0x5EBD251575EBD7AFULL,
+        0x5FBF211D65CB972FULL
+    },
+    .to_aes = {
+        0x00, 0x01, 0x03, 0x02, 0x05, 0x04, 0x06, 0x07, 0x0F, 0x0E, 0x0C, 0x0D,
+        0x0A, 0x0B, 0x09, 0x08, 0x11, 0x10, 0x12, 0x13, 0x14, 0x15, 0x17, 0x16,
+        0x1E, 0x1F, 0x1D, 0x1C, 0x1B, 0x1A, 0x18, 0x19, 0x33, 0x32, 0x30, 0x31,
+        0x36, 0x37, 0x35, 0x34, 0x3C, 0x3D, 0x3F, 0x3E, 0x39, 0x38, 0x3A, 0x3B,
+        0x22, 0x23, 0x21, 0x20, 0x27, 0x26, 0x24, 0x25, 0x2D, 0x2C, 0x2E, 0x2F,
+        0x28, 0x29, 0x2B, 0x2A, 0x55, 0x54, 0x56, 0x57, 0x50, 0x51, 0x53, 0x52,
+        0x5A, 0x5B, 0x59, 0x58, 0x5F, 0x5E, 0x5C, 0x5D, 0x44, 0x45, 0x47, 0x46,
+        0x41, 0x40, 0x42, 0x43, 0x4B, 0x4A, 0x48, 0x49, 0x4E, 0x4F, 0x4D, 0x4C,
+        0x66, 0x67, 0x65, 0x64, 0x63, 0x62, 0x60, 0x61, 0x69, 0x68, 0x6A, 0x6B,
+        0x6C, 0x6D, 0x6F, 0x6E, 0x77, 0x76, 0x74, 0x75, 0x72, 0x73, 0x71, 0x70,
+        0x78, 0x79, 0x7B, 0x7A, 0x7D, 0x7C, 0x7E, 0x7F, 0xFF, 0xFE, 0xFC, 0xFD,
+        0xFA, 0xFB, 0xF9, 0xF8, 0xF0, 0xF1, 0xF3, 0xF2, 0xF5, 0xF4, 0xF6, 0xF7,
+        0xEE, 0xEF, 0xED, 0xEC, 0xEB, 0xEA, 0xE8, 0xE9, 0xE1, 0xE0, 0xE2, 0xE3,
+        0xE4, 0xE5, 0xE7, 0xE6, 0xCC, 0xCD, 0xCF, 0xCE, 0xC9, 0xC8, 0xCA, 0xCB,
+        0xC3, 0xC2, 0xC0, 0xC1, 0xC6, 0xC7, 0xC5, 0xC4, 0xDD, 0xDC, 0xDE, 0xDF,
+        0xD8, 0xD9, 0xDB, 0xDA, 0xD2, 0xD3, 0xD1, 0xD0, 0xD7, 0xD6, 0xD4, 0xD5,
+        0xAA, 0xAB, 0xA9, 0xA8, 0xAF, 0xAE, 0xAC, 0xAD, 0xA5, 0xA4, 0xA6, 0xA7,
+        0xA0, 0xA1, 0xA3, 0xA2, 0xBB, 0xBA, 0xB8, 0xB9, 0xBE, 0xBF, 0xBD, 0xBC,
+        0xB4, 0xB5, 0xB7, 0xB6, 0xB1, 0xB0, 0xB2, 0xB3, 0x99, 0x98, 0x9A, 0x9B,
+        0x9C, 0x9D, 0x9F, 0x9E, 0x96, 0x97, 0x95, 0x94, 0x93, 0x92, 0x90, 0x91,
+        0x88, 0x89, 0x8B, 0x8A, 0x8D, 0x8C, 0x8E, 0x8F, 0x87, 0x86, 0x84, 0x85,
+        0x82, 0x83, 0x81, 0x80
+    },
+    .from_aes_affine = 0xFFAACC88F0A0C080ULL
+};
@@ -0,0 +1,808 @@
+#include "rs_bitslice.h"
+#include "rs_ec.h"
+
+// Fills in the rows of the bit matrix of multiplying by c. 
+// Bit b of row i is bit i of c * 2^b.
+static void rs_bitslice_rows(const gf8_field_t* field, 
+    uint8_t* rows, uint8_t c)
+{
+    for(int i = 0; i < 8; i++) {
+        rows[i] = 0;
+    }
+    for(int b = 0; b < 8; b++) {
+        uint8_t column = gf8_mul_nolut(field, c, (uint8_t)(1 << b));
+        for(int i = 0; i < 8; i++) {
+            rows[i] |= ((column >> i) & 1) << b;
+        }
+    }
+}
+
+// dst = c * src on one bitsliced symbol, where rows is the bit
+// matrix of c. Every bit of the result is the XOR of the source planes
+// picked out by its row, so this is 64 AND/XORs with no branches.
+static inline void rs_bitslice_mul(uint64_t* dst, const uint64_t* src, 
+    const uint8_t* rows)
+{
+    for(int i = 0; i < 8; i++) {
+        uint64_t acc = 0;
+        for(int b = 0; b < 8; b++) {
+            acc ^= src[b] & (0 - (uint64_t)((rows[i] >> b) & 1));
+        }
+        dst[i] = acc;
+    }
+}
+
+// dst = a * b where both change from lane to lane. Adds up a * x^k for 
+// every bit k of b, with a * x^k being a shift of the planes plus the 
+// polynomial folded back in. dst can be a or b.
+static inline void rs_bitslice_mul_lanes(uint64_t* dst, const uint64_t* a, 
+    const uint64_t* b, uint8_t polynomial)
+{
+    uint64_t shifted[8];
+    uint64_t acc[8];
+    uint64_t taps[8];
+    for(int i = 0; i < 8; i++) {
+        shifted[i] = a[i];
+        acc[i] = 0;
+        taps[i] = 0 - (uint64_t)((polynomial >> i) & 1);
+    }
+    for(int k = 0; k < 8; k++) {
+        for(int i = 0; i < 8; i++) {
+            acc[i] ^= shifted[i] & b[k];
+        }
+        if(k == 7) {
+            break;
+        }
+
+        // shifted *= x
+        uint64_t carry = shifted[7];
+        for(int i = 7; i > 0; i--) {
+            shifted[i] = shifted[i - 1];
+        }
+        shifted[0] = 0;
+        for(int i = 0; i < 8; i++) {
+            shifted[i] ^= carry & taps[i];
+        }
+    }
+    for(int i = 0; i < 8; i++) {
+        dst[i] = acc[i];
+    }
+}
+
+// Bitsliced a * x^k for k = 0..7, so multiplying other symbols by a 
+// after that is just the ANDs and XORs, with no shifting or folding
+static inline void rs_bitslice_multiples(uint64_t* multiples, 
+    const uint64_t* a, uint8_t polynomial)
+{
+    for(int i = 0; i < 8; i++) {
+        multiples[i] = a[i];
+    }
+    for(int k = 1; k < 8; k++) {
+        const uint64_t* previous = multiples + (k - 1) * 8;
+        uint64_t* current = multiples + k * 8;
+        uint64_t carry = previous[7];
+        current[0] = 0;
+        for(int i = 1; i < 8; i++) {
+            current[i] = previous[i - 1];
+        }
+        for(int i = 0; i < 8; i++) {
+            current[i] ^= carry & (0 - (uint64_t)((polynomial >> i) & 1));
+        }
+    }
+}
+
+// dst = a * b + c * d, with a and c as rs_bitslice_multiples
+static inline void rs_bitslice_mul_add_multiples(uint64_t* dst, 
+    const uint64_t* a, const uint64_t* b, 
+    const uint64_t* c, const uint64_t* d)
+{
+    uint64_t acc[8] = {0};
+    for(int k = 0; k < 8; k++) {
+        for(int i = 0; i < 8; i++) {
+            acc[i] ^= (a[k * 8 + i] & b[k]) ^ (c[k * 8 + i] & d[k]);
+        }
+    }
+    for(int i = 0; i < 8; i++) {
+        dst[i] = acc[i];
+    }
+}
+
+// dst = a^-1 = a^254, 0 in lanes where a is 0
+static void rs_bitslice_inv_lanes(uint64_t* dst, const uint64_t* a, 
+    uint8_t polynomial)
+{
+    // a^254 = a^2 * a^4 * ... * a^128
+    uint64_t power[8];
+    rs_bitslice_mul_lanes(power, a, a, polynomial);
+    for(int i = 0; i < 8; i++) {
+        dst[i] = power[i];
+    }
+    for(int k = 2; k < 8; k++) {
+        rs_bitslice_mul_lanes(power, power, power, polynomial);
+        rs_bitslice_mul_lanes(dst, dst, power, polynomial);
+    }
+}
+
+// Lanes where a bitsliced symbol isn't 0
+static inline uint64_t rs_bitslice_nonzero(const uint64_t* a)
+{
+    return a[0] | a[1] | a[2] | a[3] | a[4] | a[5] | a[6] | a[7];
+}
+
+// Lanes where a bitsliced 8 bit count is more than a constant
+static inline uint64_t rs_bitslice_greater(const uint64_t* count, 
+    int constant)
+{
+    uint64_t greater = 0;
+    uint64_t equal = ~(uint64_t)0;
+    for(int b = 7; b >= 0; b--) {
+        if((constant >> b) & 1) {
+            equal &= count[b];
+        } else {
+            greater |= equal & count[b];
+            equal &= ~count[b];
+        }
+    }
+    return greater;
+}
+
+// Biggest bitsliced 8 bit count in any lane. Goes down from the top 
+// bit, keeping only the lanes that have every bit found so far.
+static inline int rs_bitslice_max(const uint64_t* count)
+{
+    uint64_t lanes = ~(uint64_t)0;
+    int max = 0;
+    for(int b = 7; b >= 0; b--) {
+        if(lanes & count[b]) {
+            lanes &= count[b];
+            max |= 1 << b;
+        }
+    }
+    return max;
+}
+
+// count = constant - count in the lanes of mask, one borrow chain for 
+// all of them
+static inline void rs_bitslice_subtract_from(uint64_t* count, 
+    int constant, uint64_t mask)
+{
+    uint64_t borrow = 0;
+    for(int b = 0; b < 8; b++) {
+        uint64_t x = 0 - (uint64_t)((constant >> b) & 1);
+        uint64_t y = count[b];
+        uint64_t difference = x ^ y ^ borrow;
+        borrow = (~x & (y | borrow)) | (y & borrow);
+        count[b] = (y & ~mask) | (difference & mask);
+    }
+}
+
+// Transposes an 8x8 bit matrix. Byte k, bit b swaps with byte b, bit k.
+static inline uint64_t rs_bitslice_transpose8(uint64_t x)
+{
+    uint64_t t;
+    t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+    x = x ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+    x = x ^ t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+    x = x ^ t ^ (t << 28);
+    return x;
+}
+
+int rs_bitslice_init(const gf8_field_t* field, 
+    rs_bitslice_encoder_t* encoder, 
+    const uint8_t* generator_polynomial, int generator_length)
+{
+    // Needs at least one parity symbol and has to fit in a codeword
+    if(generator_length < 2 || generator_length > RS_BITSLICE_MAX_CODEWORD) {
+        return -1;
+    }
+
+    encoder->field = field;
+    encoder->generator_length = generator_length;
+    uint8_t root = 1;
+    for(int i = 0; i < generator_length - 1; i++) {
+        rs_bitslice_rows(field, encoder->generator_rows[i], 
+            generator_polynomial[i + 1]);
+        rs_bitslice_rows(field, encoder->root_rows[i], root);
+        root = gf8_mul_nolut(field, root, field->generator);
+    }
+    return 0;
+}
+
+void rs_bitslice_transpose_in(uint64_t* planes, const uint8_t* data, 
+    int stride, int length, int lanes)
+{
+    for(int j = 0; j < length; j++) {
+        uint64_t* symbol = planes + j * 8;
+        for(int b = 0; b < 8; b++) {
+            symbol[b] = 0;
+        }
+
+        // Eight lanes at a time, each transposed 8x8 block gives one 
+        // byte of each of the 8 planes.
+        for(int group = 0; group * 8 < lanes; group++) {
+            uint64_t x = 0;
+            for(int k = 0; k < 8; k++) {
+                int lane = group * 8 + k;
+                if(lane < lanes) {
+                    x |= (uint64_t)data[lane * stride + j] << (8 * k);
+                }
+            }
+            x = rs_bitslice_transpose8(x);
+            for(int b = 0; b < 8; b++) {
+                symbol[b] |= ((x >> (8 * b)) & 0xFF) << (8 * group);
+            }
+        }
+    }
+}
+
+void rs_bitslice_transpose_out(uint8_t* data, const uint64_t* planes, 
+    int stride, int length, int lanes)
+{
+    for(int j = 0; j < length; j++) {
+        const uint64_t* symbol = planes + j * 8;
+        for(int group = 0; group * 8 < lanes; group++) {
+            uint64_t x = 0;
+            for(int b = 0; b < 8; b++) {
+                x |= ((symbol[b] >> (8 * group)) & 0xFF) << (8 * b);
+            }
+            x = rs_bitslice_transpose8(x);
+            for(int k = 0; k < 8; k++) {
+                int lane = group * 8 + k;
+                if(lane < lanes) {
+                    data[lane * stride + j] = (uint8_t)(x >> (8 * k));
+                }
+            }
+        }
+    }
+}
+
+int rs_bitslice_encode(const rs_bitslice_encoder_t* encoder, 
+    uint64_t* planes, int message_length)
+{
+    int number_of_symbols = encoder->generator_length - 1;
+    if(message_length <= 0 || 
+        message_length + number_of_symbols > RS_BITSLICE_MAX_CODEWORD) {
+        return -1;
+    }
+
+    // Same LFSR as the byte encoders, with the remainder kept right 
+    // where the parity ends up.
+    uint64_t* remainder = planes + RS_BITSLICE_PLANES(message_length);
+    for(int i = 0; i < RS_BITSLICE_PLANES(number_of_symbols); i++) {
+        remainder[i] = 0;
+    }
+
+    for(int i = 0; i < message_length; i++) {
+        // Every output plane of every tap is the XOR of some subset of 
+        // the 8 feedback planes, so build all 256 subsets once per step. 
+        // The taps then index it with their (constant) rows.
+        uint64_t subsets[256];
+        subsets[0] = 0;
+        for(int b = 0; b < 8; b++) {
+            uint64_t feedback = planes[i * 8 + b] ^ remainder[b];
+            for(int m = 0; m < (1 << b); m++) {
+                subsets[(1 << b) | m] = subsets[m] ^ feedback;
+            }
+        }
+
+        // Shift and add in the feedback in one go
+        for(int k = 0; k < number_of_symbols - 1; k++) {
+            const uint8_t* rows = encoder->generator_rows[k];
+            for(int b = 0; b < 8; b++) {
+                remainder[k * 8 + b] = 
+                    remainder[(k + 1) * 8 + b] ^ subsets[rows[b]];
+            }
+        }
+        const uint8_t* rows = encoder->generator_rows[number_of_symbols - 1];
+        for(int b = 0; b < 8; b++) {
+            remainder[(number_of_symbols - 1) * 8 + b] = subsets[rows[b]];
+        }
+    }
+    return 0;
+}
+
+int rs_bitslice_calc_syndromes(const rs_bitslice_encoder_t* encoder, 
+    uint64_t* syndrome_planes, const uint64_t* planes, 
+    int codeword_length)
+{
+    if(codeword_length <= 0 || codeword_length > RS_BITSLICE_MAX_CODEWORD) {
+        return -1;
+    }
+
+    // First term is always 0, same as rs_calc_syndromes
+    for(int i = 0; i < RS_BITSLICE_PLANES(encoder->generator_length); i++) {
+        syndrome_planes[i] = 0;
+    }
+
+    // Horner's method for every root at once. 
+    // acc = acc * alpha^i + c[j]
+    for(int i = 0; i < encoder->generator_length - 1; i++) {
+        uint64_t* acc = syndrome_planes + (i + 1) * 8;
+        for(int j = 0; j < codeword_length; j++) {
+            uint64_t product[8];
+            rs_bitslice_mul(product, acc, encoder->root_rows[i]);
+            for(int b = 0; b < 8; b++) {
+                acc[b] = product[b] ^ planes[j * 8 + b];
+            }
+        }
+    }
+    return 0;
+}
+
+int rs_bitslice_encode_batch(const rs_bitslice_encoder_t* encoder, 
+    uint8_t* codewords, int stride, int message_length, int count, 
+    uint64_t* working_planes)
+{
+    int codeword_length = message_length + encoder->generator_length - 1;
+    if(count < 0 || stride < codeword_length) {
+        return -1;
+    }
+
+    for(int first = 0; first < count; first += RS_BITSLICE_LANES) {
+        int lanes = count - first;
+        if(lanes > RS_BITSLICE_LANES) {
+            lanes = RS_BITSLICE_LANES;
+        }
+        uint8_t* batch = codewords + first * stride;
+
+        // Only the message goes in, and only the parity comes back out
+        rs_bitslice_transpose_in(working_planes, batch, stride, 
+            message_length, lanes);
+        if(rs_bitslice_encode(encoder, working_planes, message_length) != 0) {
+            return -1;
+        }
+        rs_bitslice_transpose_out(batch + message_length, 
+            working_planes + RS_BITSLICE_PLANES(message_length), stride, 
+            codeword_length - message_length, lanes);
+    }
+    return 0;
+}
+
+int rs_bitslice_calc_syndromes_batch(const rs_bitslice_encoder_t* encoder, 
+    uint8_t* syndromes, const uint8_t* codewords, int stride, 
+    int codeword_length, int count, uint64_t* working_planes)
+{
+    if(count < 0 || stride < codeword_length) {
+        return -1;
+    }
+
+    // Syndromes go after the codeword planes
+    int generator_length = encoder->generator_length;
+    uint64_t* syndrome_planes = working_planes + 
+        RS_BITSLICE_PLANES(codeword_length);
+    for(int first = 0; first < count; first += RS_BITSLICE_LANES) {
+        int lanes = count - first;
+        if(lanes > RS_BITSLICE_LANES) {
+            lanes = RS_BITSLICE_LANES;
+        }
+
+        rs_bitslice_transpose_in(working_planes, codewords + first * stride, 
+            stride, codeword_length, lanes);
+        if(rs_bitslice_calc_syndromes(encoder, syndrome_planes, 
+            working_planes, codeword_length) != 0) {
+            return -1;
+        }
+        rs_bitslice_transpose_out(syndromes + first * generator_length, 
+            syndrome_planes, generator_length, generator_length, lanes);
+    }
+    return 0;
+}
+
+// Spreads the rows of a constant's bit matrix out into full plane 
+// masks, so multiplying by it over and over doesn't redo the shifts
+static void rs_bitslice_masks(uint64_t* masks, const uint8_t* rows)
+{
+    for(int i = 0; i < 8; i++) {
+        for(int b = 0; b < 8; b++) {
+            masks[i * 8 + b] = 0 - (uint64_t)((rows[i] >> b) & 1);
+        }
+    }
+}
+
+// symbol = c * symbol in place, with masks from rs_bitslice_masks
+static inline void rs_bitslice_mul_masks(uint64_t* symbol, 
+    const uint64_t* masks)
+{
+    uint64_t product[8];
+    for(int i = 0; i < 8; i++) {
+        uint64_t acc = 0;
+        for(int b = 0; b < 8; b++) {
+            acc ^= symbol[b] & masks[i * 8 + b];
+        }
+        product[i] = acc;
+    }
+    for(int i = 0; i < 8; i++) {
+        symbol[i] = product[i];
+    }
+}
+
+// Decodes one batch of codewords from their bitsliced syndromes, taken 
+// at the codec's roots. results gets one entry per lane. For lanes that 
+// can be fixed, slot s < results[lane] of magnitudes and positions 
+// (lane * t + s) says which degree to XOR with what.
+static void rs_bitslice_decode(const rs_codec_t* codec, 
+    const uint64_t* syndrome, uint64_t active, int* results, 
+    uint8_t* magnitudes, uint8_t* positions, uint64_t* working_planes)
+{
+    const gf8_field_t* field = codec->field;
+    int number_of_symbols = codec->generator_length - 1;
+    int t = number_of_symbols / 2;
+    uint8_t polynomial = (uint8_t)field->polynomial;
+
+    // The syndrome multiples are only needed until the locator is 
+    // found, and the Chien step masks only after, so they share space
+    uint64_t* locator = working_planes;
+    uint64_t* previous = locator + RS_BITSLICE_PLANES(t + 1);
+    uint64_t* omega = previous + RS_BITSLICE_PLANES(t + 1);
+    uint64_t* slot_odd = omega + RS_BITSLICE_PLANES(t);
+    uint64_t* slot_x_inv = slot_odd + RS_BITSLICE_PLANES(t);
+    uint64_t* slot_position = slot_x_inv + RS_BITSLICE_PLANES(t);
+    uint64_t* syndrome_multiples = slot_position + RS_BITSLICE_PLANES(t);
+    uint64_t* step_masks = syndrome_multiples;
+
+    for(int lane = 0; lane < RS_BITSLICE_LANES; lane++) {
+        results[lane] = ((active >> lane) & 1) ? -1 : 0;
+    }
+    // Nothing to fix, or nothing that could be fixed
+    if(active == 0 || t == 0) {
+        return;
+    }
+
+    // Inversionless Berlekamp-Massey. Lanes only differ in whether they 
+    // take the new length, which is a mask instead of a branch, with the 
+    // usual 2L <= r test done on a bitsliced L. A lane's locator never 
+    // has more than L terms, so each step only works out terms up to 
+    // the biggest L so far. With few errors that's a handful of terms 
+    // instead of all t. Lanes that need more than t can't be fixed, and 
+    // their terms past t are dropped.
+    for(int i = 0; i < RS_BITSLICE_PLANES(t + 1); i++) {
+        locator[i] = 0;
+        previous[i] = 0;
+    }
+    for(int i = 0; i < 2 * t; i++) {
+        rs_bitslice_multiples(syndrome_multiples + i * 64, 
+            syndrome + i * 8, polynomial);
+    }
+    locator[0] = ~(uint64_t)0;
+    previous[0] = ~(uint64_t)0;
+    uint64_t gamma[8] = { ~(uint64_t)0, 0, 0, 0, 0, 0, 0, 0 };
+    uint64_t length[8] = {0};
+    uint64_t failed = 0;
+    int bound = 0;
+    for(int r = 0; r < 2 * t; r++) {
+        // Discrepancy of S_r against the locator
+        uint64_t discrepancy[8] = {0};
+        for(int j = 0; j <= bound && j <= r; j++) {
+            const uint64_t* s = syndrome_multiples + (r - j) * 64;
+            const uint64_t* term = locator + j * 8;
+            for(int k = 0; k < 8; k++) {
+                for(int b = 0; b < 8; b++) {
+                    discrepancy[b] ^= s[k * 8 + b] & term[k];
+                }
+            }
+        }
+        uint64_t nonzero = rs_bitslice_nonzero(discrepancy);
+        if(nonzero == 0) {
+            // Every lane's locator still holds, so it's just the shift
+            for(int i = t; i > 0; i--) {
+                for(int b = 0; b < 8; b++) {
+                    previous[i * 8 + b] = previous[(i - 1) * 8 + b];
+                }
+            }
+            for(int b = 0; b < 8; b++) {
+                previous[b] = 0;
+            }
+            continue;
+        }
+        uint64_t swap = nonzero & ~rs_bitslice_greater(length, r / 2);
+        rs_bitslice_subtract_from(length, r + 1, swap);
+        failed |= rs_bitslice_greater(length, t);
+        int longest = rs_bitslice_max(length);
+        if(longest > t) {
+            bound = t;
+        } else if(longest > bound) {
+            bound = longest;
+        }
+
+        // locator = gamma locator - discrepancy x previous, and previous 
+        // takes the old locator in the lanes that swap and x previous 
+        // everywhere else
+        uint64_t gamma_multiples[64];
+        uint64_t discrepancy_multiples[64];
+        rs_bitslice_multiples(gamma_multiples, gamma, polynomial);
+        rs_bitslice_multiples(discrepancy_multiples, discrepancy, 
+            polynomial);
+        for(int i = t; i >= 0; i--) {
+            uint64_t shifted[8] = {0};
+            if(i > 0) {
+                for(int b = 0; b < 8; b++) {
+                    shifted[b] = previous[(i - 1) * 8 + b];
+                }
+            }
+            uint64_t old[8];
+            for(int b = 0; b < 8; b++) {
+                old[b] = locator[i * 8 + b];
+            }
+            if(i <= bound) {
+                rs_bitslice_mul_add_multiples(locator + i * 8, 
+                    gamma_multiples, old, discrepancy_multiples, shifted);
+            }
+            for(int b = 0; b < 8; b++) {
+                previous[i * 8 + b] = (shifted[b] & ~swap) | 
+                    (old[b] & swap);
+            }
+        }
+        for(int b = 0; b < 8; b++) {
+            gamma[b] = (gamma[b] & ~swap) | (discrepancy[b] & swap);
+        }
+    }
+
+    // Degree of each lane's locator. Terms past the highest one are 0 
+    // in every lane, so the Chien search can leave them out.
+    int degree[RS_BITSLICE_LANES] = {0};
+    int max_degree = 0;
+    for(int i = 1; i <= t; i++) {
+        uint64_t nonzero = rs_bitslice_nonzero(locator + i * 8);
+        if(nonzero != 0) {
+            max_degree = i;
+        }
+        for(int lane = 0; lane < RS_BITSLICE_LANES; lane++) {
+            if((nonzero >> lane) & 1) {
+                degree[lane] = i;
+            }
+        }
+    }
+    // No locator anywhere, so no lane can be fixed
+    if(max_degree == 0) {
+        return;
+    }
+
+    // Error evaluator Omega = S Lambda mod x^t. Its degree is below the 
+    // locator's, so it stops short of max_degree. It's scaled by the 
+    // same constant as the locator, which cancels out in Forney.
+    for(int i = 0; i < max_degree; i++) {
+        uint64_t* term = omega + i * 8;
+        for(int b = 0; b < 8; b++) {
+            term[b] = 0;
+        }
+        for(int j = 0; j <= i; j++) {
+            uint64_t product[8];
+            rs_bitslice_mul_lanes(product, locator + j * 8, 
+                syndrome + (i - j) * 8, polynomial);
+            for(int b = 0; b < 8; b++) {
+                term[b] ^= product[b];
+            }
+        }
+    }
+    // An odd number of parity symbols leaves S_2t out of 
+    // Berlekamp-Massey. The locator still has to agree with it.
+    if(number_of_symbols & 1) {
+        uint64_t check[8] = {0};
+        for(int i = 0; i <= t; i++) {
+            uint64_t product[8];
+            rs_bitslice_mul_lanes(product, locator + i * 8, 
+                syndrome + (2 * t - i) * 8, polynomial);
+            for(int b = 0; b < 8; b++) {
+                check[b] ^= product[b];
+            }
+        }
+        failed |= rs_bitslice_nonzero(check);
+    }
+
+    // Chien search over X = alpha^(prim * e). Term i of the locator 
+    // holds its coefficient times X^-i for the current degree e, and 
+    // gets multiplied by alpha^(-prim * i) to move on. Each root found 
+    // goes in the lane's next free slot along with what Forney needs, 
+    // so Omega and the divides are only worked out once per slot 
+    // afterwards instead of at every degree.
+    for(int i = 1; i <= max_degree; i++) {
+        uint8_t rows[8];
+        int log_step = (0xFF - (codec->prim * i) % 0xFF) % 0xFF;
+        rs_bitslice_rows(field, rows, field->exp[log_step]);
+        rs_bitslice_masks(step_masks + (i - 1) * 64, rows);
+    }
+    for(int i = 0; i < RS_BITSLICE_PLANES(max_degree); i++) {
+        slot_odd[i] = 0;
+        slot_x_inv[i] = 0;
+        slot_position[i] = 0;
+    }
+    // free_slot[s] holds the lanes whose next free slot is s
+    uint64_t free_slot[RS_BITSLICE_MAX_CODEWORD / 2 + 1] = {0};
+    free_slot[0] = ~(uint64_t)0;
+    uint64_t x_inv[8] = { ~(uint64_t)0, 0, 0, 0, 0, 0, 0, 0 };
+    for(int e = 0; e < codec->n; e++) {
+        uint64_t sum[8];
+        uint64_t odd[8] = {0};
+        for(int b = 0; b < 8; b++) {
+            sum[b] = locator[b];
+        }
+        for(int i = 1; i <= max_degree; i++) {
+            for(int b = 0; b < 8; b++) {
+                sum[b] ^= locator[i * 8 + b];
+                if(i & 1) {
+                    odd[b] ^= locator[i * 8 + b];
+                }
+            }
+        }
+
+        uint64_t root = active & ~failed & ~rs_bitslice_nonzero(sum);
+        if(root != 0) {
+            // A zero derivative or more roots than the locator's degree 
+            // are both hopeless
+            uint64_t usable = root & rs_bitslice_nonzero(odd) & 
+                ~free_slot[max_degree];
+            failed |= root & ~usable;
+            for(int s = max_degree - 1; s >= 0; s--) {
+                uint64_t lanes = free_slot[s] & usable;
+                if(lanes == 0) {
+                    continue;
+                }
+                for(int b = 0; b < 8; b++) {
+                    uint64_t position = 0 - (uint64_t)((e >> b) & 1);
+                    slot_odd[s * 8 + b] |= odd[b] & lanes;
+                    slot_x_inv[s * 8 + b] |= x_inv[b] & lanes;
+                    slot_position[s * 8 + b] |= position & lanes;
+                }
+                free_slot[s] ^= lanes;
+                free_slot[s + 1] |= lanes;
+            }
+        }
+
+        for(int i = 1; i <= max_degree; i++) {
+            rs_bitslice_mul_masks(locator + i * 8, 
+                step_masks + (i - 1) * 64);
+        }
+        rs_bitslice_mul_masks(x_inv, step_masks);
+    }
+
+    // Forney. The magnitude X^(1 - fcr) Omega(X^-1) / Lambda'(X^-1) is 
+    // Omega(X^-1) over the sum of the odd locator terms, times X^-fcr. 
+    // Empty slots come out as 0.
+    for(int s = 0; s < max_degree; s++) {
+        uint64_t* x_inv_slot = slot_x_inv + s * 8;
+        uint64_t value[8];
+        for(int b = 0; b < 8; b++) {
+            value[b] = omega[(max_degree - 1) * 8 + b];
+        }
+        for(int i = max_degree - 2; i >= 0; i--) {
+            rs_bitslice_mul_lanes(value, value, x_inv_slot, polynomial);
+            for(int b = 0; b < 8; b++) {
+                value[b] ^= omega[i * 8 + b];
+            }
+        }
+        if(codec->fcr != 0) {
+            // Square and multiply
+            uint64_t power[8];
+            for(int b = 0; b < 8; b++) {
+                power[b] = x_inv_slot[b];
+            }
+            for(int fcr = codec->fcr; fcr != 0; fcr >>= 1) {
+                if(fcr & 1) {
+                    rs_bitslice_mul_lanes(value, value, power, polynomial);
+                }
+                if(fcr > 1) {
+                    rs_bitslice_mul_lanes(power, power, power, polynomial);
+                }
+            }
+        }
+        uint64_t inverse[8];
+        rs_bitslice_inv_lanes(inverse, slot_odd + s * 8, polynomial);
+        rs_bitslice_mul_lanes(slot_odd + s * 8, value, inverse, polynomial);
+    }
+    rs_bitslice_transpose_out(magnitudes, slot_odd, t, max_degree, 
+        RS_BITSLICE_LANES);
+    rs_bitslice_transpose_out(positions, slot_position, t, max_degree, 
+        RS_BITSLICE_LANES);
+
+    // A lane is good if every root of its locator was in the codeword, 
+    // and the locator is as long as Berlekamp-Massey said it had to be. 
+    // A shorter one only looks like it fits.
+    uint64_t good = active & ~failed;
+    for(int lane = 0; lane < RS_BITSLICE_LANES; lane++) {
+        int s = degree[lane];
+        int lane_length = 0;
+        for(int b = 0; b < 8; b++) {
+            lane_length |= (int)((length[b] >> lane) & 1) << b;
+        }
+        if(s > 0 && s == lane_length && 
+            ((good & free_slot[s]) >> lane) & 1) {
+            results[lane] = s;
+        }
+    }
+}
+
+int rs_decode_batch(rs_codec_t* codec, uint8_t* codewords, int stride, 
+    int count, int* results, uint64_t* working_planes)
+{
+    const gf8_field_t* field = codec->field;
+    int generator_length = codec->generator_length;
+    int number_of_symbols = generator_length - 1;
+    int n = codec->n;
+    int k = codec->k;
+    if(count < 0 || stride < n) {
+        return -1;
+    }
+
+    // Byte syndromes of the lanes, their planes, where each lane's fixes
+    // go, then the decoder scratch
+    int t = number_of_symbols / 2;
+    uint8_t* syndromes = (uint8_t*)working_planes;
+    uint64_t* syndrome_planes = working_planes + 
+        RS_BITSLICE_PLANES(generator_length);
+    uint8_t* magnitudes = (uint8_t*)(syndrome_planes + 
+        RS_BITSLICE_PLANES(generator_length));
+    uint8_t* positions = magnitudes + RS_BITSLICE_LANES * t;
+    uint64_t* scratch = (uint64_t*)(positions + RS_BITSLICE_LANES * t);
+
+    // Every codeword gets checked on its own through the parity matrix,
+    // which is the fastest way to see it's clean. Clean ones and ones 
+    // with a single bad symbol are done right there, and only the rest 
+    // get packed into lanes, so a batch is always full until the end.
+    int lane_codeword[RS_BITSLICE_LANES];
+    int lanes = 0;
+    for(int c = 0; c <= count; c++) {
+        if(c < count) {
+            uint8_t* codeword = codewords + (size_t)c * stride;
+            uint8_t remainder[255];
+            rs_parity_matrix_encode_parity(&codec->parity_matrix, 
+                remainder, codeword, k);
+            int clean = 1;
+            for(int j = 0; j < number_of_symbols; j++) {
+                remainder[j] ^= codeword[k + j];
+                clean &= (remainder[j] == 0);
+            }
+            results[c] = 0;
+            if(clean) {
+                continue;
+            }
+
+            // The generator is 0 at every root, so c and c mod g agree 
+            // there
+            uint8_t* syndrome = syndromes + lanes * generator_length;
+            gf8_region_eval(field, syndrome, remainder, number_of_symbols, 
+                codec->roots, number_of_symbols);
+            int e;
+            uint8_t magnitude;
+            if(rs_decode_single_error(field, syndrome, number_of_symbols, 
+                codec->fcr, codec->prim, &e, &magnitude)) {
+                if(e < n) {
+                    codeword[n - 1 - e] ^= magnitude;
+                    results[c] = 1;
+                } else {
+                    results[c] = -1;
+                }
+                continue;
+            }
+            lane_codeword[lanes++] = c;
+            if(lanes < RS_BITSLICE_LANES) {
+                continue;
+            }
+        }
+        if(lanes == 0) {
+            continue;
+        }
+
+        int batch_results[RS_BITSLICE_LANES];
+        uint64_t active = lanes == RS_BITSLICE_LANES ? ~(uint64_t)0 : 
+            ((uint64_t)1 << lanes) - 1;
+        rs_bitslice_transpose_in(syndrome_planes, syndromes, 
+            generator_length, number_of_symbols, lanes);
+        rs_bitslice_decode(codec, syndrome_planes, active, batch_results, 
+            magnitudes, positions, scratch);
+
+        // Degree e is counted from the end of the codeword
+        for(int lane = 0; lane < lanes; lane++) {
+            uint8_t* codeword = codewords + 
+                (size_t)lane_codeword[lane] * stride;
+            results[lane_codeword[lane]] = batch_results[lane];
+            for(int s = 0; s < batch_results[lane]; s++) {
+                codeword[n - 1 - positions[lane * t + s]] ^= 
+                    magnitudes[lane * t + s];
+            }
+        }
+        lanes = 0;
+    }
+    return 0;
+}
@@ -0,0 +1,161 @@
+#ifndef _RS_BITSLICE_H_
+#define _RS_BITSLICE_H_
+
+#include <stdint.h>
+#include "galois_field_8.h"
+#include "rs_ec.h"
+
+/*
+ * Bitsliced Reed-Solomon over GF(2^8)
+ *
+ * Runs the same code as rs_ec.h on RS_BITSLICE_LANES codewords at once.
+ * Symbol j of every codeword is stored as 8 bit-planes, 
+ * planes[j * 8 + b], where bit L of a plane is bit b of codeword L's 
+ * symbol. Multiplying by a constant is then just ANDs and XORs on whole 
+ * planes, so there are no lookup tables or data dependent memory 
+ * accesses at all once the encoder is built.
+ */
+
+// Codewords handled per batch, one per bit of a plane
+#define RS_BITSLICE_LANES 64
+
+// Longest codeword in symbols
+#define RS_BITSLICE_MAX_CODEWORD 0xFF
+
+// Number of planes needed to hold length symbols
+#define RS_BITSLICE_PLANES(length) ((length) * 8)
+
+// Working planes rs_decode_batch needs
+#define RS_BITSLICE_DECODE_PLANES(generator_length) \
+    RS_BITSLICE_PLANES(14 * (generator_length))
+
+typedef struct rs_bitslice_encoder {
+    // Field the code is over
+    const gf8_field_t* field;
+    // Length of the generator polynomial (number of parity symbols + 1)
+    int generator_length;
+    // Bit matrix of each generator coefficient after the leading 1. 
+    // Row i picks out the input bits that XOR into output bit i.
+    uint8_t generator_rows[RS_BITSLICE_MAX_CODEWORD][8];
+    // Same for alpha^i, the roots the syndromes are evaluated at
+    uint8_t root_rows[RS_BITSLICE_MAX_CODEWORD][8];
+} rs_bitslice_encoder_t;
+
+/*
+    * Builds a bitsliced encoder from a generator polynomial
+    * @param field Field to work in
+    * @param encoder Encoder to initialize
+    * @param generator_polynomial Generator polynomial to use, from
+    *       rs_generator_polynomial
+    * @param generator_length Length of the generator polynomial
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_bitslice_init(const gf8_field_t* field, 
+    rs_bitslice_encoder_t* encoder, 
+    const uint8_t* generator_polynomial, int generator_length);
+
+/*
+    * Transposes up to RS_BITSLICE_LANES codewords into bit-planes
+    * @param planes Needs to be at least RS_BITSLICE_PLANES(length)
+    * @param data First codeword. Codeword L starts at data + L * stride
+    * @param stride Distance between codewords in bytes
+    * @param length Number of symbols to transpose from each codeword
+    * @param lanes Number of codewords. Missing lanes are zero.
+*/
+void rs_bitslice_transpose_in(uint64_t* planes, const uint8_t* data, 
+    int stride, int length, int lanes);
+
+/*
+    * Transposes bit-planes back into up to RS_BITSLICE_LANES codewords
+    * @param data First codeword. Codeword L starts at data + L * stride
+    * @param planes Planes to transpose, RS_BITSLICE_PLANES(length)
+    * @param stride Distance between codewords in bytes
+    * @param length Number of symbols to write to each codeword
+    * @param lanes Number of codewords to write
+*/
+void rs_bitslice_transpose_out(uint8_t* data, const uint64_t* planes, 
+    int stride, int length, int lanes);
+
+/*
+    * Encodes RS_BITSLICE_LANES messages that are already bitsliced
+    * @param encoder Encoder to use
+    * @param planes Holds the message planes, and needs room for
+    *       RS_BITSLICE_PLANES(message_length + generator_length - 1).
+    *       The parity planes are written after the message.
+    * @param message_length Length of the messages
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_bitslice_encode(const rs_bitslice_encoder_t* encoder, 
+    uint64_t* planes, int message_length);
+
+/*
+    * Calculates the syndromes of RS_BITSLICE_LANES bitsliced codewords
+    * @param encoder Encoder to use
+    * @param syndrome_planes Needs to be at least 
+    *       RS_BITSLICE_PLANES(generator_length). The first symbol is 
+    *       always 0 like rs_calc_syndromes.
+    * @param planes Codeword planes
+    * @param codeword_length Length of the codewords
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_bitslice_calc_syndromes(const rs_bitslice_encoder_t* encoder, 
+    uint64_t* syndrome_planes, const uint64_t* planes, 
+    int codeword_length);
+
+/*
+    * Encodes any number of codewords in place, RS_BITSLICE_LANES at a time
+    * @param encoder Encoder to use
+    * @param codewords First codeword. Each one holds message_length
+    *       message bytes and the parity is written right after.
+    * @param stride Distance between codewords in bytes
+    * @param message_length Length of the messages
+    * @param count Number of codewords
+    * @param working_planes Needs to be at least 
+    *       RS_BITSLICE_PLANES(message_length + generator_length - 1)
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_bitslice_encode_batch(const rs_bitslice_encoder_t* encoder, 
+    uint8_t* codewords, int stride, int message_length, int count, 
+    uint64_t* working_planes);
+
+/*
+    * Calculates the syndromes of any number of codewords
+    * @param encoder Encoder to use
+    * @param syndromes Syndromes of codeword L start at
+    *       syndromes + L * generator_length
+    * @param codewords First codeword
+    * @param stride Distance between codewords in bytes
+    * @param codeword_length Length of the codewords
+    * @param count Number of codewords
+    * @param working_planes Needs to be at least 
+    *       RS_BITSLICE_PLANES(codeword_length + generator_length)
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_bitslice_calc_syndromes_batch(const rs_bitslice_encoder_t* encoder, 
+    uint8_t* syndromes, const uint8_t* codewords, int stride, 
+    int codeword_length, int count, uint64_t* working_planes);
+
+/*
+    * Corrects any number of codewords of a codec in place. Each one is
+    * checked on its own through the codec's parity matrix, and the 
+    * clean ones and ones with a single bad symbol are fixed right there 
+    * like rs_codec_decode would. The rest get transposed into lanes, 
+    * RS_BITSLICE_LANES at a time, and an inversionless Berlekamp-Massey,
+    * the Chien search and Forney run on all the lanes together, since 
+    * every lane goes through the exact same steps.
+    * @param codec Codec for the code, any fcr and prim
+    * @param codewords First codeword, k data bytes then the parity
+    * @param stride Distance between codewords in bytes
+    * @param count Number of codewords
+    * @param results Gets what rs_codec_decode would return for each 
+    *       codeword. The number of symbols corrected, 0 if there were no
+    *       errors, or -1 if there were too many to correct. Codewords 
+    *       that get -1 aren't modified.
+    * @param working_planes Needs to be at least 
+    *       RS_BITSLICE_DECODE_PLANES(generator_length)
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_decode_batch(rs_codec_t* codec, uint8_t* codewords, int stride, 
+    int count, int* results, uint64_t* working_planes);
+
+#endif
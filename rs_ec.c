@@ -1,8 +1,18 @@
 #include "rs_ec.h"
-#include "galois_field_8.h"
 #include <stdio.h>
+#include <string.h>
 
-int rs_generator_polynomial(uint8_t* buffer, 
+// Encoder table and parity matrix rows get padded out to this
+#define RS_ROW_ALIGN 16
+
+// Longest a padded row can get, 254 parity symbols padded out
+#define RS_MAX_ROW 256
+
+// Length of a row of number_of_symbols bytes once it's padded out
+#define RS_ROW_STRIDE(number_of_symbols) \
+    (((number_of_symbols) + RS_ROW_ALIGN - 1) & ~(RS_ROW_ALIGN - 1))
+
+int rs_generator_polynomial(const gf8_field_t* field, uint8_t* buffer, 
     uint8_t* working_buffer, int generator_length)
 {
 
@@ -24,19 +34,20 @@ int rs_generator_polynomial(uint8_t* buffer,
     // Remember, number of symbols is generator_length - 1
     int number_of_symbols = generator_length - 1;
     for(int i = 0; i < number_of_symbols; i++) {
-        // Populate our new value of q
-        q[1] = gf8_pow(2, i);
+        // Populate our new value of q, the i-th power of the 
+        // field's generator
+        q[1] = field->exp[i % 0xFF];
         
         if(current_buffer == 0) {
             // Multiply the current buffer by q and store the result in the
             // working buffer
-            polyres = gf8_poly_mul(working_buffer, buffer, 
+            polyres = gf8_poly_mul(field, working_buffer, buffer, 
                 q, i + 1, 2);
             current_buffer = 1;
         } else {
             // Multiply the working buffer by q and store the result in the
             // current buffer
-            polyres = gf8_poly_mul(buffer, working_buffer, 
+            polyres = gf8_poly_mul(field, buffer, working_buffer, 
                 q, i + 1, 2);
             current_buffer = 0;
         }
@@ -55,50 +66,342 @@ int rs_generator_polynomial(uint8_t* buffer,
     return 0;
 }
 
-int rs_encode(
+int rs_encode(const gf8_field_t* field,
     uint8_t* buffer, uint8_t* working_buffer,
     uint8_t* message, int message_length, 
     uint8_t* generator_polynomial, int generator_length)
 {
-    // We can't encode a message with a buffer size over 255
-    int buffer_size = message_length + generator_length - 1;
-    if(buffer_size > 255) {
+    // The division only ever needs the remainder, so it's done as an 
+    // LFSR over the message itself. Nothing past the message gets read 
+    // and a shortened code only costs its own length.
+    (void)working_buffer;
+    uint8_t parity[256];
+    if(rs_encode_parity(field, parity, message, message_length, 
+        generator_polynomial, generator_length) != 0) {
         return -1;
     }
 
-    // Zero out the buffers
-    for(int i = 0; i < buffer_size; i++) {
-        buffer[i] = 0;
-        working_buffer[i] = 0;
+    // Copy the message and the remainder to the buffer
+    if(buffer != message) {
+        memmove(buffer, message, message_length);
     }
+    memcpy(buffer + message_length, parity, generator_length - 1);
+    return 0;
+}
 
-    // The remainder of the division will be the RS Code
-    // We store it in working buffer for now.
-    int result = gf8_poly_div(buffer, working_buffer, 
-        message, generator_polynomial, 
-        buffer_size, generator_length);
+int rs_encode_parity(const gf8_field_t* field, uint8_t* parity, 
+    const uint8_t* message, int message_length, 
+    const uint8_t* generator_polynomial, int generator_length)
+{
+    int number_of_symbols = generator_length - 1;
+    if(generator_length < 2 || message_length < 1 || 
+        message_length + number_of_symbols > 255) {
+        return -1;
+    }
+
+    // Same division as rs_encode, but the quotient is never kept. The 
+    // remainder slides down a window, so each step is one region 
+    // multiply with no shifting.
+    uint8_t window[256];
+    memset(window, 0, message_length + number_of_symbols);
+    for(int i = 0; i < message_length; i++) {
+        uint8_t feedback = window[i] ^ message[i];
+        if(feedback != 0) {
+            gf8_region_mul_xor(field, window + i + 1, 
+                generator_polynomial + 1, feedback, number_of_symbols);
+        }
+    }
+    const uint8_t* remainder = window + message_length;
+    memcpy(parity, remainder, number_of_symbols);
+    return 0;
+}
+
+// dst += row, a word at a time. Lengths are multiples of RS_ROW_ALIGN.
+static inline void rs_encoder_xor_row(uint8_t* dst, const uint8_t* row, 
+    int length)
+{
+    for(int j = 0; j < length; j += 8) {
+        uint64_t a, b;
+        memcpy(&a, dst + j, 8);
+        memcpy(&b, row + j, 8);
+        a ^= b;
+        memcpy(dst + j, &a, 8);
+    }
+}
 
+size_t rs_encoder_table_size(int generator_length, int slices)
+{
+    if(generator_length < 2 || slices < 1) {
+        return 0;
+    }
+    return (size_t)slices * 256 * RS_ROW_STRIDE(generator_length - 1);
+}
 
-    // Make sure it succeeded
-    if(result != 0) {
+int rs_encoder_init(const gf8_field_t* field, rs_encoder_t* encoder, 
+    uint8_t* table, const uint8_t* generator_polynomial, 
+    int generator_length, int slices)
+{
+    int number_of_symbols = generator_length - 1;
+    if(generator_length < 2 || generator_length > 255) {
+        return -1;
+    }
+    // The slices have to fit in the remainder
+    if(slices < 1 || slices > RS_ENCODER_MAX_SLICES || 
+        slices > number_of_symbols) {
         return -1;
     }
 
-    // Copy the mesage and the remainder to the buffer
-    // We skip the first term in the remainder since it's 0
-    for(int i = 0; i < buffer_size; i++) {
-        if(i < message_length) {
-            buffer[i] = message[i];
-        } else {
-            buffer[i] = working_buffer[(i - message_length)+1];
+    encoder->field = field;
+    encoder->generator_length = generator_length;
+    encoder->slices = slices;
+    encoder->row_stride = RS_ROW_STRIDE(number_of_symbols);
+    encoder->table = table;
+
+    // X^nsym mod g is just the generator without its leading 1 
+    // since g is monic. Each further slice is one more multiply by X.
+    uint8_t power[256];
+    for(int j = 0; j < number_of_symbols; j++) {
+        power[j] = generator_polynomial[j + 1];
+    }
+
+    int row_stride = encoder->row_stride;
+    for(int s = 0; s < slices; s++) {
+        uint8_t* slice = table + (size_t)s * 256 * row_stride;
+        for(int x = 0; x < 256; x++) {
+            uint8_t* row = slice + x * row_stride;
+            gf8_region_mul(field, row, power, (uint8_t)x, number_of_symbols);
+            // The padding has to stay 0 so XORing it in does nothing
+            for(int j = number_of_symbols; j < row_stride; j++) {
+                row[j] = 0;
+            }
+        }
+
+        // power = power * X mod g
+        uint8_t top = power[0];
+        for(int j = 0; j < number_of_symbols - 1; j++) {
+            power[j] = power[j + 1];
+        }
+        power[number_of_symbols - 1] = 0;
+        gf8_region_mul_xor(field, power, generator_polynomial + 1, 
+            top, number_of_symbols);
+    }
+    return 0;
+}
+
+// Runs the LFSR over a message starting from the remainder of whatever
+// came before it, and returns where the new remainder ended up in 
+// window. The window needs room for 256 + RS_MAX_ROW bytes and 
+// message_length + nsym has to be under 256. A 0 start is a fresh 
+// message.
+static const uint8_t* rs_encoder_run_from(const rs_encoder_t* encoder, 
+    uint8_t* window, const uint8_t* start, 
+    const uint8_t* message, int message_length)
+{
+    // Rather than shifting the remainder every step we slide down the 
+    // window. The remainder after i bytes lives at window[i .. i + nsym),
+    // and everything past it is still 0. The rows are padded out so the
+    // window is too.
+    int number_of_symbols = encoder->generator_length - 1;
+    int row_stride = encoder->row_stride;
+    memset(window, 0, message_length + number_of_symbols + row_stride);
+    if(start) {
+        memcpy(window, start, number_of_symbols);
+    }
+
+    const uint8_t* table = encoder->table;
+    int slices = encoder->slices;
+    size_t slice_size = 256 * (size_t)row_stride;
+    int i = 0;
+
+    // Slice-by-N. With r the remainder and m the message bytes, N steps
+    // come out to shift(r, N) + sum of T[N-1-k][r[k] + m[k]]
+    if(slices > 1) {
+        for(; i + slices <= message_length; i += slices) {
+            uint8_t* dst = window + i + slices;
+            for(int k = 0; k < slices; k++) {
+                uint8_t feedback = window[i + k] ^ message[i + k];
+                rs_encoder_xor_row(dst, table + 
+                    (size_t)(slices - 1 - k) * slice_size + 
+                    (size_t)feedback * row_stride, row_stride);
+            }
+        }
+    }
+
+    // Whatever is left goes one byte at a time
+    for(; i < message_length; i++) {
+        uint8_t feedback = window[i] ^ message[i];
+        rs_encoder_xor_row(window + i + 1, 
+            table + (size_t)feedback * row_stride, row_stride);
+    }
+    return window + message_length;
+}
+
+// Runs the LFSR over a whole message, see rs_encoder_run_from
+static const uint8_t* rs_encoder_run(const rs_encoder_t* encoder, 
+    uint8_t* window, const uint8_t* message, int message_length)
+{
+    return rs_encoder_run_from(encoder, window, 0, message, message_length);
+}
+
+int rs_encoder_state_init(rs_encoder_state_t* state, 
+    const rs_encoder_t* encoder)
+{
+    state->encoder = encoder;
+    state->message_length = 0;
+    memset(state->remainder, 0, sizeof(state->remainder));
+    return 0;
+}
+
+int rs_encoder_state_update(rs_encoder_state_t* state, 
+    const uint8_t* bytes, int length)
+{
+    const rs_encoder_t* encoder = state->encoder;
+    int number_of_symbols = encoder->generator_length - 1;
+    if(length < 0 || 
+        state->message_length + length + number_of_symbols > 255) {
+        return -1;
+    }
+    if(length == 0) {
+        return 0;
+    }
+
+    // Picking the remainder back up is the same as if the bytes before
+    // had been in this call too, so it runs at the one-shot speed
+    uint8_t window[256 + RS_MAX_ROW];
+    const uint8_t* remainder = rs_encoder_run_from(encoder, window, 
+        state->remainder, bytes, length);
+    memcpy(state->remainder, remainder, number_of_symbols);
+    state->message_length += length;
+    return 0;
+}
+
+int rs_encoder_state_finalize(const rs_encoder_state_t* state, 
+    uint8_t* parity)
+{
+    // Can't encode an empty message
+    if(state->message_length < 1) {
+        return -1;
+    }
+    memcpy(parity, state->remainder, state->encoder->generator_length - 1);
+    return 0;
+}
+
+int rs_encoder_encode_parity(const rs_encoder_t* encoder, uint8_t* parity, 
+    const uint8_t* message, int message_length)
+{
+    int number_of_symbols = encoder->generator_length - 1;
+    if(message_length <= 0 || message_length + number_of_symbols > 255) {
+        return -1;
+    }
+
+    uint8_t window[256 + RS_MAX_ROW];
+    const uint8_t* remainder = rs_encoder_run(encoder, window, 
+        message, message_length);
+    memcpy(parity, remainder, number_of_symbols);
+    return 0;
+}
+
+int rs_encoder_encode(const rs_encoder_t* encoder, uint8_t* buffer, 
+    const uint8_t* message, int message_length)
+{
+    // Message followed by the remainder
+    if(rs_encoder_encode_parity(encoder, buffer + message_length, 
+        message, message_length) != 0) {
+        return -1;
+    }
+    if(buffer != message) {
+        memcpy(buffer, message, message_length);
+    }
+    return 0;
+}
+
+size_t rs_parity_matrix_size(int message_length, int generator_length)
+{
+    if(message_length < 1 || generator_length < 2) {
+        return 0;
+    }
+    return (size_t)message_length * RS_ROW_STRIDE(generator_length - 1);
+}
+
+int rs_parity_matrix_init(const gf8_field_t* field, 
+    rs_parity_matrix_t* parity_matrix, uint8_t* matrix, 
+    const uint8_t* generator_polynomial, int generator_length, 
+    int message_length)
+{
+    int number_of_symbols = generator_length - 1;
+    if(generator_length < 2 || message_length < 1 || 
+        message_length + number_of_symbols > 255) {
+        return -1;
+    }
+
+    int row_stride = RS_ROW_STRIDE(number_of_symbols);
+    parity_matrix->field = field;
+    parity_matrix->generator_length = generator_length;
+    parity_matrix->message_length = message_length;
+    parity_matrix->row_stride = row_stride;
+    parity_matrix->matrix = matrix;
+
+    // The last row is X^nsym mod g, which is the generator without its
+    // leading 1. Every row above it is one more multiply by X.
+    uint8_t* row = matrix + (size_t)(message_length - 1) * row_stride;
+    for(int j = 0; j < row_stride; j++) {
+        row[j] = (j < number_of_symbols) ? generator_polynomial[j + 1] : 0;
+    }
+    for(int i = message_length - 2; i >= 0; i--) {
+        const uint8_t* below = matrix + (size_t)(i + 1) * row_stride;
+        row = matrix + (size_t)i * row_stride;
+
+        // row = below * X mod g
+        for(int j = 0; j < row_stride; j++) {
+            row[j] = (j < number_of_symbols - 1) ? below[j + 1] : 0;
         }
+        gf8_region_mul_xor(field, row, generator_polynomial + 1, 
+            below[0], number_of_symbols);
+    }
+    return 0;
+}
+
+int rs_parity_matrix_encode_parity(const rs_parity_matrix_t* parity_matrix, 
+    uint8_t* parity, const uint8_t* message, int message_length)
+{
+    if(message_length < 1 || message_length > parity_matrix->message_length) {
+        return -1;
     }
+
+    // A shorter message is a longer one with leading zeroes, 
+    // so it just uses the last rows.
+    int row_stride = parity_matrix->row_stride;
+    const uint8_t* rows = parity_matrix->matrix + 
+        (size_t)(parity_matrix->message_length - message_length) * row_stride;
+
+    // Every parity symbol is its own dot product of the message with a 
+    // column of the matrix. The padding columns come out as 0, and only
+    // the real ones get handed back.
+    uint8_t padded[RS_MAX_ROW];
+    gf8_region_dot(parity_matrix->field, padded, rows, row_stride, 
+        message, message_length, row_stride);
+    memcpy(parity, padded, parity_matrix->generator_length - 1);
     return 0;
 }
 
-int rs_calc_syndromes(
+int rs_parity_matrix_encode(const rs_parity_matrix_t* parity_matrix, 
+    uint8_t* buffer, const uint8_t* message, int message_length)
+{
+    // Message followed by the parity
+    if(rs_parity_matrix_encode_parity(parity_matrix, buffer + message_length, 
+        message, message_length) != 0) {
+        return -1;
+    }
+    if(buffer != message) {
+        memcpy(buffer, message, message_length);
+    }
+    return 0;
+}
+
+int rs_calc_syndromes(const gf8_field_t* field,
     uint8_t* buffer, uint8_t* message, 
-    int message_length, int generator_length)
+    int message_length, int generator_length,
+    const rs_parity_matrix_t* parity_matrix)
 {
     // Zero out the buffer
     for(int i = 0; i < generator_length; i++) {
@@ -109,12 +412,449 @@ int rs_calc_syndromes(
     // We calculate offset by 1 since the first term is 0
     // Also remember the number of symbols is 
     // generator_length - 1 anyways so it works out nicely
-    for(int i=0; i < generator_length-1; i++) {
-        buffer[i+1] = gf8_poly_eval(message, gf8_pow(2, i), 
-            message_length);
+    int number_of_symbols = generator_length - 1;
+    if(!parity_matrix) {
+        return gf8_region_syndromes(field, buffer + 1, message, 
+            message_length, number_of_symbols);
     }
 
-    return 0;
+    // Reduce modulo the generator first. The parity of the message part
+    // is m * X^nsym mod g, so adding the received parity to it leaves
+    // c mod g, which is 0 for a clean codeword.
+    uint8_t remainder[RS_MAX_ROW];
+    if(parity_matrix->generator_length != generator_length ||
+        rs_parity_matrix_encode_parity(parity_matrix, remainder, message, 
+        message_length - number_of_symbols) != 0) {
+        return -1;
+    }
+    int clean = 1;
+    for(int j = 0; j < number_of_symbols; j++) {
+        remainder[j] ^= message[message_length - number_of_symbols + j];
+        clean &= (remainder[j] == 0);
+    }
+    if(clean) {
+        return 0;
+    }
+
+    // The generator is 0 at every root, so c and c mod g agree there. 
+    // The remainder is only nsym long instead of the whole codeword.
+    return gf8_region_syndromes(field, buffer + 1, remainder, 
+        number_of_symbols, number_of_symbols);
+}
+
+// Berlekamp-Massey on lowest order first polynomials. locator comes in
+// holding the erasure locator (just 1 without erasures) and leaves as 
+// the errata locator. Only syndromes from erasure_count on are needed
+// since the erasure locator already accounts for the ones before it.
+// Returns the degree of the errata locator.
+static int rs_berlekamp_massey(const gf8_field_t* field, 
+    uint8_t* locator, uint8_t* previous, uint8_t* scratch, 
+    const uint8_t* syndromes, int number_of_symbols, int erasure_count)
+{
+    for(int i = 0; i <= number_of_symbols; i++) {
+        previous[i] = locator[i];
+    }
+
+    int length = erasure_count;
+    int shift = 1;
+    uint8_t previous_discrepancy = 1;
+    for(int r = erasure_count; r < number_of_symbols; r++) {
+        // How far off the current locator is at this syndrome
+        uint8_t discrepancy = syndromes[r];
+        for(int i = 1; i <= length; i++) {
+            discrepancy ^= gf8_mul(field, locator[i], syndromes[r - i]);
+        }
+        if(discrepancy == 0) {
+            shift++;
+            continue;
+        }
+
+        // locator -= (d / b) x^shift previous
+        uint8_t scale = gf8_div(field, discrepancy, previous_discrepancy);
+        if(2 * length <= r + erasure_count) {
+            for(int i = 0; i <= number_of_symbols; i++) {
+                scratch[i] = locator[i];
+            }
+            gf8_region_mul_xor(field, locator + shift, previous, scale, 
+                number_of_symbols + 1 - shift);
+            for(int i = 0; i <= number_of_symbols; i++) {
+                previous[i] = scratch[i];
+            }
+            length = r + 1 + erasure_count - length;
+            previous_discrepancy = discrepancy;
+            shift = 1;
+        } else {
+            gf8_region_mul_xor(field, locator + shift, previous, scale, 
+                number_of_symbols + 1 - shift);
+            shift++;
+        }
+    }
+    return length;
+}
+
+// Evaluates a lowest order first polynomial at x = alpha^log_x using 
+// the log tables, so each term is a couple of lookups instead of a 
+// multiply. exp is doubled so the sum of two logs can index it directly.
+static uint8_t rs_poly_eval_log(const gf8_field_t* field, 
+    const uint8_t* p, int p_len, int log_x)
+{
+    uint8_t result = 0;
+    int log_power = 0;
+    for(int i = 0; i < p_len; i++) {
+        if(p[i] != 0) {
+            result ^= field->exp[field->log[p[i]] + log_power];
+        }
+        log_power += log_x;
+        if(log_power >= 0xFF) {
+            log_power -= 0xFF;
+        }
+    }
+    return result;
+}
+
+// Rows powers[i][j] = alpha^(-i prim j) for the Chien search. They only
+// depend on the code, so a codec works them out once.
+static void rs_chien_powers(const gf8_field_t* field, int prim, 
+    int rows, uint8_t* powers)
+{
+    for(int i = 0; i < rows; i++) {
+        int log_step = (0xFF - (i * prim) % 0xFF) % 0xFF;
+        int log_power = 0;
+        for(int j = 0; j < RS_CHIEN_BLOCK; j++) {
+            powers[i * RS_CHIEN_BLOCK + j] = field->exp[log_power];
+            log_power += log_step;
+            if(log_power >= 0xFF) {
+                log_power -= 0xFF;
+            }
+        }
+    }
+}
+
+// Where the powers go in a working buffer of 
+// RS_DECODE_BUFFER_SIZE(generator_length), after the 5 polynomials and 
+// one Chien block. There's room for all generator_length rows.
+static uint8_t* rs_decode_buffer_powers(uint8_t* working_buffer, 
+    int generator_length)
+{
+    return working_buffer + 5 * generator_length + RS_CHIEN_BLOCK;
+}
+
+// Chien search. An error at degree e has locator X = alpha^(prim * e) 
+// and Lambda(X^-1) = sum of Lambda_i alpha^(-i prim e) = 0. 
+// Over a block of RS_CHIEN_BLOCK degrees starting at e0 that's a dot 
+// product of the coefficients Lambda_i alpha^(-i prim e0) with the 
+// first errata + 1 rows of powers, so a whole block is one 
+// gf8_region_dot. Moving to the next block only scales each coefficient.
+// Only the degrees inside the codeword are searched, so a shortened code
+// never looks at the zeroes in front of it.
+// Returns the number of roots found, or -1 if there are more than errata.
+static int rs_chien_search(const gf8_field_t* field, 
+    const uint8_t* locator, int errata, int message_length, int prim, 
+    uint8_t* positions, uint8_t* coefficients, uint8_t* block, 
+    const uint8_t* powers)
+{
+    for(int i = 0; i <= errata; i++) {
+        coefficients[i] = locator[i];
+    }
+
+    int found = 0;
+    for(int e0 = 0; e0 < message_length; e0 += RS_CHIEN_BLOCK) {
+        int len = message_length - e0;
+        if(len > RS_CHIEN_BLOCK) {
+            len = RS_CHIEN_BLOCK;
+        }
+        gf8_region_dot(field, block, powers, RS_CHIEN_BLOCK, coefficients, 
+            errata + 1, len);
+        for(int j = 0; j < len; j++) {
+            if(block[j] == 0) {
+                if(found == errata) {
+                    // More roots than the degree, can't be right
+                    return -1;
+                }
+                positions[found++] = (uint8_t)(e0 + j);
+            }
+        }
+
+        // Lambda_i *= alpha^(-i prim RS_CHIEN_BLOCK)
+        for(int i = 1; i <= errata; i++) {
+            if(coefficients[i] != 0) {
+                int log_step = (i * prim * RS_CHIEN_BLOCK) % 0xFF;
+                coefficients[i] = field->exp[field->log[coefficients[i]] + 
+                    0xFF - log_step];
+            }
+        }
+    }
+    return found;
+}
+
+int rs_decode_single_error(const gf8_field_t* field, 
+    const uint8_t* syndromes, int number_of_symbols, int fcr, int prim, 
+    int* degree, uint8_t* magnitude)
+{
+    // With a single error of value Y at X = alpha^(prim * e), 
+    // S_i = Y X^(fcr + i), so every S_(i+1) / S_i has to be X. Compares
+    // in the log domain so it's one table lookup per syndrome. Below 2 
+    // syndromes it can't correct anything anyway.
+    if(number_of_symbols < 2 || syndromes[0] == 0 || syndromes[1] == 0) {
+        return 0;
+    }
+
+    int log_previous = field->log[syndromes[1]];
+    int log_x = log_previous - field->log[syndromes[0]];
+    if(log_x < 0) {
+        log_x += 0xFF;
+    }
+    for(int i = 2; i < number_of_symbols; i++) {
+        if(syndromes[i] == 0) {
+            return 0;
+        }
+        int expected = log_previous + log_x;
+        if(expected >= 0xFF) {
+            expected -= 0xFF;
+        }
+        int log_current = field->log[syndromes[i]];
+        if(log_current != expected) {
+            return 0;
+        }
+        log_previous = log_current;
+    }
+
+    // log X = prim * e, so e needs prim inverted mod 255
+    int e = log_x;
+    if(prim != 1) {
+        int prim_inverse = 0;
+        for(int i = 1; i < 0xFF; i++) {
+            if((prim * i) % 0xFF == 1) {
+                prim_inverse = i;
+                break;
+            }
+        }
+        e = (log_x * prim_inverse) % 0xFF;
+    }
+
+    // Y = S_0 / X^fcr
+    int log_y = (field->log[syndromes[0]] - fcr * log_x) % 0xFF;
+    if(log_y < 0) {
+        log_y += 0xFF;
+    }
+    *degree = e;
+    *magnitude = field->exp[log_y];
+    return 1;
+}
+
+// The symbol at degree e of a codeword that's data followed by 
+// number_of_symbols parity symbols, which don't have to be next to 
+// each other
+static uint8_t* rs_symbol_at(uint8_t* data, int data_length, 
+    uint8_t* parity, int number_of_symbols, int e)
+{
+    if(e < number_of_symbols) {
+        return &parity[number_of_symbols - 1 - e];
+    }
+    return &data[data_length - 1 - (e - number_of_symbols)];
+}
+
+// Decodes with the roots at alpha^(prim * (fcr + i)). syndromes holds
+// the number_of_symbols syndromes without the leading 0. erasures are
+// indexes into the codeword, data first then parity, that are known to 
+// be bad. chien_powers can hold all nsym + 1 rows from rs_chien_powers,
+// or be 0 to work out just the ones needed in working_buffer. They can 
+// already be sitting in working_buffer's own powers.
+// Returns the number of symbols corrected, or -1.
+static int rs_decode_internal(const gf8_field_t* field, 
+    uint8_t* data, int data_length, uint8_t* parity, 
+    const uint8_t* syndromes, int number_of_symbols, int fcr, int prim, 
+    const int* erasures, int erasure_count, uint8_t* working_buffer, 
+    const uint8_t* chien_powers)
+{
+    int message_length = data_length + number_of_symbols;
+    if(erasure_count < 0 || erasure_count > number_of_symbols) {
+        return -1;
+    }
+    for(int i = 0; i < erasure_count; i++) {
+        if(erasures[i] < 0 || erasures[i] >= message_length) {
+            return -1;
+        }
+    }
+
+    // Nothing to do for a clean codeword
+    int clean = 1;
+    for(int i = 0; i < number_of_symbols; i++) {
+        if(syndromes[i] != 0) {
+            clean = 0;
+            break;
+        }
+    }
+    if(clean) {
+        return 0;
+    }
+
+    // Almost every bad codeword has exactly one bad symbol, which doesn't
+    // need a locator at all
+    if(erasure_count == 0) {
+        int e;
+        uint8_t magnitude;
+        if(rs_decode_single_error(field, syndromes, number_of_symbols, 
+            fcr, prim, &e, &magnitude)) {
+            if(e >= message_length) {
+                return -1;
+            }
+            *rs_symbol_at(data, data_length, parity, number_of_symbols, e) ^= 
+                magnitude;
+            return 1;
+        }
+    }
+
+    int generator_length = number_of_symbols + 1;
+    uint8_t* locator = working_buffer;
+    uint8_t* previous = locator + generator_length;
+    uint8_t* scratch = previous + generator_length;
+    uint8_t* evaluator = scratch + generator_length;
+    uint8_t* positions = evaluator + generator_length;
+    uint8_t* block = positions + generator_length;
+    uint8_t* powers = rs_decode_buffer_powers(working_buffer, 
+        generator_length);
+
+    // Erasure locator Gamma(x) = prod (1 - X x) over the erasures, with 
+    // X = alpha^(prim * e) for an erasure at degree e
+    for(int i = 0; i <= number_of_symbols; i++) {
+        locator[i] = 0;
+    }
+    locator[0] = 1;
+    for(int k = 0; k < erasure_count; k++) {
+        int e = message_length - 1 - erasures[k];
+        uint8_t x = field->exp[(prim * e) % 0xFF];
+        // Multiply by (1 - X x), from the top down so it can be in place
+        for(int i = k + 1; i > 0; i--) {
+            locator[i] ^= gf8_mul(field, locator[i - 1], x);
+        }
+        positions[k] = (uint8_t)e;
+    }
+
+    // Forney syndromes S(x) Gamma(x) mod x^nsym. If the ones past the
+    // erasures are all 0 there are no unknown errors. Gamma is then the
+    // whole errata locator and this is already the evaluator, so 
+    // Berlekamp-Massey and the Chien search can both be skipped.
+    int only_erasures = 1;
+    for(int i = 0; i < number_of_symbols; i++) {
+        uint8_t value = 0;
+        for(int j = 0; j <= i && j <= erasure_count; j++) {
+            value ^= gf8_mul(field, locator[j], syndromes[i - j]);
+        }
+        evaluator[i] = value;
+        if(i >= erasure_count && value != 0) {
+            only_erasures = 0;
+        }
+    }
+
+    int errata = erasure_count;
+    if(!only_erasures) {
+        errata = rs_berlekamp_massey(field, locator, previous, scratch, 
+            syndromes, number_of_symbols, erasure_count);
+        // Each unknown error costs two parity symbols, each erasure one
+        if(errata <= erasure_count || 
+            2 * errata - erasure_count > number_of_symbols) {
+            return -1;
+        }
+
+        if(!chien_powers) {
+            rs_chien_powers(field, prim, errata + 1, powers);
+            chien_powers = powers;
+        }
+        int found = rs_chien_search(field, locator, errata, 
+            message_length, prim, positions, previous, block, chien_powers);
+        // Roots outside the codeword or repeated ones mean too many errors
+        if(found != errata) {
+            return -1;
+        }
+
+        // Error evaluator Omega(x) = S(x) Lambda(x) mod x^nsym
+        for(int i = 0; i < number_of_symbols; i++) {
+            uint8_t value = 0;
+            for(int j = 0; j <= i && j <= errata; j++) {
+                value ^= gf8_mul(field, locator[j], syndromes[i - j]);
+            }
+            evaluator[i] = value;
+        }
+    }
+
+    // Forney. The magnitude at X is X^(1 - fcr) Omega(X^-1) / Lambda'(X^-1)
+    // and in GF(2^m) Lambda' is just the odd terms shifted down. It's all
+    // done with logs, so the divide and the X^(1 - fcr) are adds.
+    // All of them get worked out before touching the message so it's 
+    // left alone if something doesn't add up.
+    uint8_t* magnitudes = scratch;
+    uint8_t* odd_terms = previous;
+    int odd_count = 0;
+    for(int i = 1; i <= errata; i += 2) {
+        odd_terms[odd_count++] = locator[i];
+    }
+    for(int k = 0; k < errata; k++) {
+        int log_x = (prim * positions[k]) % 0xFF;
+        int log_x_inv = (0xFF - log_x) % 0xFF;
+        int log_x_inv_squared = (2 * log_x_inv) % 0xFF;
+
+        uint8_t derivative = rs_poly_eval_log(field, odd_terms, odd_count, 
+            log_x_inv_squared);
+        // Also catches the same erasure being given twice
+        if(derivative == 0) {
+            return -1;
+        }
+        uint8_t omega = rs_poly_eval_log(field, evaluator, 
+            number_of_symbols, log_x_inv);
+        if(omega == 0) {
+            magnitudes[k] = 0;
+            continue;
+        }
+
+        int log_magnitude = (field->log[omega] - field->log[derivative] + 
+            (1 - fcr) * log_x) % 0xFF;
+        if(log_magnitude < 0) {
+            log_magnitude += 0xFF;
+        }
+        magnitudes[k] = field->exp[log_magnitude];
+    }
+
+    // Degree e is counted from the end of the codeword. Erasures that 
+    // turned out to be right don't count as corrected.
+    int corrected = 0;
+    for(int k = 0; k < errata; k++) {
+        *rs_symbol_at(data, data_length, parity, number_of_symbols, 
+            positions[k]) ^= magnitudes[k];
+        if(magnitudes[k] != 0) {
+            corrected++;
+        }
+    }
+    return corrected;
+}
+
+int rs_decode(const gf8_field_t* field, 
+    uint8_t* message, int message_length, 
+    const uint8_t* syndromes, int generator_length, 
+    uint8_t* working_buffer)
+{
+    return rs_decode_erasures(field, message, message_length, syndromes, 
+        generator_length, 0, 0, working_buffer);
+}
+
+int rs_decode_erasures(const gf8_field_t* field, 
+    uint8_t* message, int message_length, 
+    const uint8_t* syndromes, int generator_length, 
+    const int* erasures, int erasure_count, 
+    uint8_t* working_buffer)
+{
+    int number_of_symbols = generator_length - 1;
+    if(number_of_symbols < 1 || message_length <= number_of_symbols || 
+        message_length > 255) {
+        return -1;
+    }
+
+    // rs_calc_syndromes puts a 0 in front, skip it. Its roots start at 
+    // alpha^0 and go up one power at a time.
+    int data_length = message_length - number_of_symbols;
+    return rs_decode_internal(field, message, data_length, 
+        message + data_length, syndromes + 1, number_of_symbols, 0, 1, 
+        erasures, erasure_count, working_buffer, 0);
 }
 
 int rs_check_if_error(uint8_t* syndromes, int syndromes_length)
@@ -126,4 +866,201 @@ int rs_check_if_error(uint8_t* syndromes, int syndromes_length)
         }
     }
     return 0;
-}
\ No newline at end of file
+}
+size_t rs_codec_memory_size(int n, int k, int slices)
+{
+    int generator_length = n - k + 1;
+    if(k < 1 || n <= k || n > 255 || slices < 0) {
+        return 0;
+    }
+    size_t size = RS_DECODE_BUFFER_SIZE(generator_length) + 
+        rs_parity_matrix_size(k, generator_length);
+    if(slices > 0) {
+        size += rs_encoder_table_size(generator_length, slices);
+    }
+    return size;
+}
+
+static int rs_gcd(int a, int b)
+{
+    while(b != 0) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+int rs_codec_init(rs_codec_t* codec, const gf8_field_t* field, 
+    int n, int k, int fcr, int prim, uint8_t* memory, int slices)
+{
+    int number_of_symbols = n - k;
+    if(k < 1 || n <= k || n > 255) {
+        return -1;
+    }
+    // The roots only stay distinct if prim generates the whole group
+    if(fcr < 0 || fcr > 254 || prim < 1 || prim > 254 || 
+        rs_gcd(prim, 0xFF) != 1) {
+        return -1;
+    }
+    if(slices < 0 || slices > RS_ENCODER_MAX_SLICES || 
+        slices > number_of_symbols) {
+        return -1;
+    }
+
+    codec->field = field;
+    codec->n = n;
+    codec->k = k;
+    codec->fcr = fcr;
+    codec->prim = prim;
+    codec->generator_length = number_of_symbols + 1;
+    codec->slices = slices;
+    codec->decode_buffer = memory;
+
+    // g(x) = prod (x - r_i), built up one root at a time from the top 
+    // down so it can be in place
+    uint8_t* generator = codec->generator;
+    memset(generator, 0, sizeof(codec->generator));
+    generator[0] = 1;
+    for(int i = 0; i < number_of_symbols; i++) {
+        int log_root = (prim * (fcr + i)) % 0xFF;
+        codec->root_logs[i] = (uint8_t)log_root;
+        codec->roots[i] = field->exp[log_root];
+        for(int j = i + 1; j > 0; j--) {
+            generator[j] ^= gf8_mul(field, generator[j - 1], 
+                codec->roots[i]);
+        }
+    }
+    for(int j = 0; j <= number_of_symbols; j++) {
+        codec->generator_log[j] = (generator[j] == 0) ? 0xFF : 
+            field->log[generator[j]];
+    }
+
+    // Decode scratch, the parity matrix, then the encoder table. The 
+    // decode scratch already has room for every row of the Chien 
+    // search's powers, and decoding with them never writes there, so 
+    // they're worked out once right in place.
+    codec->chien_powers = rs_decode_buffer_powers(memory, 
+        codec->generator_length);
+    rs_chien_powers(field, prim, codec->generator_length, 
+        codec->chien_powers);
+    uint8_t* matrix = memory + 
+        RS_DECODE_BUFFER_SIZE(codec->generator_length);
+    if(rs_parity_matrix_init(field, &codec->parity_matrix, matrix, 
+        generator, codec->generator_length, k) != 0) {
+        return -1;
+    }
+    if(slices > 0) {
+        return rs_encoder_init(field, &codec->encoder, 
+            matrix + rs_parity_matrix_size(k, codec->generator_length), 
+            generator, codec->generator_length, slices);
+    }
+    return 0;
+}
+
+// Gets data * X^nsym mod g, plus the parity if there is one. That's the
+// parity for encoding and c mod g for checking. Without a table it's the
+// parity matrix, which every codec has. Returns where the remainder 
+// ended up in window.
+static uint8_t* rs_codec_remainder(const rs_codec_t* codec, 
+    uint8_t* window, const uint8_t* data, const uint8_t* parity)
+{
+    int number_of_symbols = codec->generator_length - 1;
+    uint8_t* remainder = window;
+    if(codec->slices > 0) {
+        remainder = (uint8_t*)rs_encoder_run(&codec->encoder, window, 
+            data, codec->k);
+    } else {
+        rs_parity_matrix_encode_parity(&codec->parity_matrix, remainder, 
+            data, codec->k);
+    }
+
+    if(parity) {
+        for(int j = 0; j < number_of_symbols; j++) {
+            remainder[j] ^= parity[j];
+        }
+    }
+    return remainder;
+}
+
+int rs_codec_encode(const rs_codec_t* codec, const uint8_t* data, 
+    uint8_t* parity)
+{
+    uint8_t window[256 + RS_MAX_ROW];
+    const uint8_t* remainder = rs_codec_remainder(codec, window, data, 0);
+    memcpy(parity, remainder, codec->generator_length - 1);
+    return 0;
+}
+
+int rs_update_parity(const rs_codec_t* codec, uint8_t* parity, 
+    int offset, const uint8_t* old_bytes, const uint8_t* new_bytes, 
+    int length)
+{
+    if(offset < 0 || length < 0 || offset + length > codec->k) {
+        return -1;
+    }
+    if(length == 0) {
+        return 0;
+    }
+
+    // The code is linear, so the parity moves by the parity of the 
+    // change on its own. Row i of the parity matrix is what data byte i 
+    // adds to the parity, so that's one dot product over just the rows
+    // that changed.
+    const rs_parity_matrix_t* parity_matrix = &codec->parity_matrix;
+    int row_stride = parity_matrix->row_stride;
+    uint8_t delta[256];
+    for(int i = 0; i < length; i++) {
+        delta[i] = old_bytes[i] ^ new_bytes[i];
+    }
+    uint8_t change[RS_MAX_ROW];
+    gf8_region_dot(codec->field, change, 
+        parity_matrix->matrix + (size_t)offset * row_stride, row_stride, 
+        delta, length, row_stride);
+    for(int j = 0; j < codec->generator_length - 1; j++) {
+        parity[j] ^= change[j];
+    }
+    return 0;
+}
+
+int rs_codec_check(const rs_codec_t* codec, const uint8_t* data, 
+    const uint8_t* parity)
+{
+    uint8_t window[256 + RS_MAX_ROW];
+    const uint8_t* remainder = rs_codec_remainder(codec, window, 
+        data, parity);
+
+    // Every syndrome is 0 exactly when the remainder is
+    for(int j = 0; j < codec->generator_length - 1; j++) {
+        if(remainder[j] != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int rs_codec_decode(rs_codec_t* codec, uint8_t* data, uint8_t* parity)
+{
+    return rs_codec_decode_erasures(codec, data, parity, 0, 0);
+}
+
+int rs_codec_decode_erasures(rs_codec_t* codec, uint8_t* data, 
+    uint8_t* parity, const int* erasures, int erasure_count)
+{
+    int number_of_symbols = codec->generator_length - 1;
+    uint8_t window[256 + RS_MAX_ROW];
+    const uint8_t* remainder = rs_codec_remainder(codec, window, 
+        data, parity);
+
+    // The generator is 0 at every root, so the syndromes only need the 
+    // remainder evaluated at the cached roots
+    uint8_t syndromes[255];
+    if(gf8_region_eval(codec->field, syndromes, remainder, 
+        number_of_symbols, codec->roots, number_of_symbols) != 0) {
+        return -1;
+    }
+    return rs_decode_internal(codec->field, data, codec->k, parity, 
+        syndromes, number_of_symbols, codec->fcr, codec->prim, 
+        erasures, erasure_count, codec->decode_buffer, 
+        codec->chien_powers);
+}
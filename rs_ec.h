@@ -2,9 +2,101 @@
 #define _RS_EC_H_
 
 #include <stdint.h>
+#include <stddef.h>
+#include "galois_field_8.h"
+
+// Most bytes a table encoder can consume per step
+#define RS_ENCODER_MAX_SLICES 8
+
+// Encoder specialized to one generator polynomial. It's a CRC style
+// LFSR: table slice s holds x * X^(nsym + s) mod g for every byte x,
+// so each input byte is one row load and an nsym wide XOR, and slice-by-N
+// folds N bytes into a single pass over the remainder.
+typedef struct rs_encoder {
+    const gf8_field_t* field;
+    // Length of the generator polynomial (number of parity symbols + 1)
+    int generator_length;
+    // Bytes consumed per step
+    int slices;
+    // Rows are padded with zeroes to a multiple of 16 bytes so they can
+    // be XORed a word at a time
+    int row_stride;
+    // slices * 256 rows of row_stride bytes
+    uint8_t* table;
+} rs_encoder_t;
+
+// Message in progress for a table encoder, so it can be fed in pieces.
+// Everything it needs is in here, so copying the struct checkpoints it 
+// and copying it back restores it.
+typedef struct rs_encoder_state {
+    const rs_encoder_t* encoder;
+    // Bytes fed in so far
+    int message_length;
+    // Remainder of what's been fed in so far, generator_length - 1 bytes
+    uint8_t remainder[255];
+} rs_encoder_state_t;
+
+// Number of positions the Chien search checks per step
+#define RS_CHIEN_BLOCK 64
+
+// Size of the working buffer rs_decode needs
+#define RS_DECODE_BUFFER_SIZE(generator_length) \
+    (5 * (generator_length) + ((generator_length) + 1) * RS_CHIEN_BLOCK)
+
+// Systematic parity matrix of an (n, k) code. Row i is 
+// X^(nsym + k - 1 - i) mod g, so the parity of a message m is 
+// sum of m[i] * row i. Each parity symbol is an independent dot 
+// product over the message with no serial dependency between bytes.
+typedef struct rs_parity_matrix {
+    const gf8_field_t* field;
+    // Length of the generator polynomial (number of parity symbols + 1)
+    int generator_length;
+    // Longest message (k). Shorter ones use the last rows.
+    int message_length;
+    // Rows are padded with zeroes to a multiple of 16 bytes
+    int row_stride;
+    // message_length rows of row_stride bytes
+    uint8_t* matrix;
+} rs_parity_matrix_t;
+
+// Everything about one (n, k) code worked out up front. The roots are 
+// alpha^(prim * (fcr + i)), so codes like CCSDS's that don't start at 
+// alpha^0 work too. The codec owns its memory, and decoding uses the 
+// scratch in there, so a codec shouldn't be decoding on two threads 
+// at once.
+typedef struct rs_codec {
+    const gf8_field_t* field;
+    // Codeword length and data length
+    int n;
+    int k;
+    // First consecutive root and the step between roots, as powers of 
+    // alpha
+    int fcr;
+    int prim;
+    // n - k + 1
+    int generator_length;
+    // Generator polynomial, highest order first
+    uint8_t generator[256];
+    // Logs of the generator's coefficients, 0xFF for a 0 coefficient
+    uint8_t generator_log[256];
+    // The n - k roots and their logs
+    uint8_t roots[255];
+    uint8_t root_logs[255];
+    // What each data byte adds to the parity, one row per byte
+    rs_parity_matrix_t parity_matrix;
+    // Table encoder, unused when the codec was built without slices
+    int slices;
+    rs_encoder_t encoder;
+    // RS_DECODE_BUFFER_SIZE(generator_length) bytes
+    uint8_t* decode_buffer;
+    // Every row the Chien search can need, generator_length rows of 
+    // RS_CHIEN_BLOCK, kept in the unused powers of decode_buffer
+    uint8_t* chien_powers;
+} rs_codec_t;
 
 /*
     * Computes a generator polynomial for a Reed-Solomon code
+    * @param field Field to work in
     * @param buffer Needs to be at least twice the size 
     *       of generator_length 
     * @param working_buffer Needs to be at least twice the size 
@@ -13,18 +105,17 @@
     *   !!NOTE that this will create (generator_length - 1) symbols
     * @return 0 if the operation was successful, -1 otherwise
 */
-int rs_generator_polynomial(uint8_t* buffer, 
+int rs_generator_polynomial(const gf8_field_t* field, uint8_t* buffer, 
     uint8_t* working_buffer, int generator_length);
 
 /*
     * Encodes a message using a Reed-Solomon code
+    * @param field Field to work in
     * @param buffer Needs to be at least the size of
     *       (message_length + generator_length)
-    * @param working_buffer Needs to be at least the size of
-    *       (message_length + generator_length)
-    * @param message Message to encode Needs to be at least the size of
-    *       (message_length + generator_length)
-    *       The area after the message should be zeroed out
+    * @param working_buffer Not used anymore
+    * @param message Message to encode. Only message_length bytes are 
+    *       read, so it doesn't need any padding.
     * @param message_length Length of the message
     * @param generator_polynomial Generator polynomial to use
     * @param generator_length Length of the generator polynomial
@@ -34,23 +125,188 @@ int rs_generator_polynomial(uint8_t* buffer,
     *   by the RS code. Also note that the message_length and
     *   generator_length should be less than 256.
 */
-int rs_encode(
+int rs_encode(const gf8_field_t* field,
     uint8_t* buffer, uint8_t* working_buffer,
     uint8_t* message, int message_length, 
     uint8_t* generator_polynomial, int generator_length);
 
+/*
+    * Encodes a message without copying it. Only the parity gets 
+    * written, and the message doesn't need any room after it.
+    * @param field Field to work in
+    * @param parity Gets the (generator_length - 1) parity symbols. 
+    *       Can be right after the message or anywhere else, but can't
+    *       overlap it.
+    * @param message Message to encode
+    * @param message_length Length of the message
+    * @param generator_polynomial Generator polynomial to use
+    * @param generator_length Length of the generator polynomial
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_encode_parity(const gf8_field_t* field, uint8_t* parity, 
+    const uint8_t* message, int message_length, 
+    const uint8_t* generator_polynomial, int generator_length);
+
+/*
+    * Gets the size of the table a table encoder needs
+    * @param generator_length Length of the generator polynomial
+    * @param slices Number of bytes consumed per step
+    * @return Size of the table in bytes
+*/
+size_t rs_encoder_table_size(int generator_length, int slices);
+
+/*
+    * Builds a table encoder for a generator polynomial
+    * @param field Field to work in
+    * @param encoder Encoder to initialize
+    * @param table Needs to be at least 
+    *       rs_encoder_table_size(generator_length, slices)
+    *       It belongs to the encoder afterwards.
+    * @param generator_polynomial Generator polynomial to use, from
+    *       rs_generator_polynomial
+    * @param generator_length Length of the generator polynomial
+    * @param slices Number of bytes to consume per step, 1 to
+    *       RS_ENCODER_MAX_SLICES and at most generator_length - 1
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_encoder_init(const gf8_field_t* field, rs_encoder_t* encoder, 
+    uint8_t* table, const uint8_t* generator_polynomial, 
+    int generator_length, int slices);
+
+/*
+    * Encodes a message with a table encoder. Same output as rs_encode.
+    * @param encoder Encoder to use
+    * @param buffer Needs to be at least the size of
+    *       (message_length + generator_length - 1)
+    *       Can be the same as message.
+    * @param message Message to encode
+    * @param message_length Length of the message
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_encoder_encode(const rs_encoder_t* encoder, uint8_t* buffer, 
+    const uint8_t* message, int message_length);
+
+/*
+    * Starts a message that gets fed to a table encoder in pieces
+    * @param state State to initialize
+    * @param encoder Encoder to use. Has to outlive the state.
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_encoder_state_init(rs_encoder_state_t* state, 
+    const rs_encoder_t* encoder);
+
+/*
+    * Feeds the next piece of a message. Pieces can be any size and 
+    * the parity comes out the same as encoding it all at once.
+    * @param state State of the message so far
+    * @param bytes Next piece of the message
+    * @param length Length of the piece, can be 0
+    * @return 0 if the operation was successful, -1 if the message 
+    *       would get too long for a codeword. The state isn't changed
+    *       if it returns -1.
+*/
+int rs_encoder_state_update(rs_encoder_state_t* state, 
+    const uint8_t* bytes, int length);
+
+/*
+    * Gets the parity of everything fed in so far. The state isn't 
+    * changed, so more can still be fed in after.
+    * @param state State of the message so far
+    * @param parity Gets the (generator_length - 1) parity symbols
+    * @return 0 if the operation was successful, -1 if nothing has 
+    *       been fed in yet
+*/
+int rs_encoder_state_finalize(const rs_encoder_state_t* state, 
+    uint8_t* parity);
+
+/*
+    * Encodes a message with a table encoder without copying it. Same 
+    * parity as rs_encoder_encode.
+    * @param encoder Encoder to use
+    * @param parity Gets the (generator_length - 1) parity symbols. 
+    *       Can be right after the message or anywhere else, but can't
+    *       overlap it.
+    * @param message Message to encode
+    * @param message_length Length of the message
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_encoder_encode_parity(const rs_encoder_t* encoder, uint8_t* parity, 
+    const uint8_t* message, int message_length);
+
+/*
+    * Gets the size of the matrix a parity matrix encoder needs
+    * @param message_length Longest message to encode (k)
+    * @param generator_length Length of the generator polynomial
+    * @return Size of the matrix in bytes
+*/
+size_t rs_parity_matrix_size(int message_length, int generator_length);
+
+/*
+    * Builds the systematic parity matrix for a generator polynomial
+    * @param field Field to work in
+    * @param parity_matrix Encoder to initialize
+    * @param matrix Needs to be at least 
+    *       rs_parity_matrix_size(message_length, generator_length)
+    *       It belongs to the encoder afterwards.
+    * @param generator_polynomial Generator polynomial to use, from
+    *       rs_generator_polynomial
+    * @param generator_length Length of the generator polynomial
+    * @param message_length Longest message to encode (k)
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_parity_matrix_init(const gf8_field_t* field, 
+    rs_parity_matrix_t* parity_matrix, uint8_t* matrix, 
+    const uint8_t* generator_polynomial, int generator_length, 
+    int message_length);
+
+/*
+    * Encodes a message with a parity matrix. Same output as rs_encode.
+    * @param parity_matrix Encoder to use
+    * @param buffer Needs to be at least the size of
+    *       (message_length + generator_length - 1)
+    *       Can be the same as message.
+    * @param message Message to encode
+    * @param message_length Length of the message, up to the 
+    *       message_length the matrix was built for
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_parity_matrix_encode(const rs_parity_matrix_t* parity_matrix, 
+    uint8_t* buffer, const uint8_t* message, int message_length);
+
+/*
+    * Encodes a message with a parity matrix without copying it. Same 
+    * parity as rs_parity_matrix_encode.
+    * @param parity_matrix Encoder to use
+    * @param parity Gets the (generator_length - 1) parity symbols. 
+    *       Can be right after the message or anywhere else, but can't
+    *       overlap it.
+    * @param message Message to encode
+    * @param message_length Length of the message, up to the 
+    *       message_length the matrix was built for
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_parity_matrix_encode_parity(const rs_parity_matrix_t* parity_matrix, 
+    uint8_t* parity, const uint8_t* message, int message_length);
 
 /*
     * Calculates the syndromes of a message
+    * @param field Field to work in
     * @param buffer Needs to be at least the size of generator_length
     * @param message Message to calculate the syndromes of
     * @param message_length Length of the message
     * @param generator_length Length of the generator polynomial
+    * @param parity_matrix 0 to evaluate the whole message at every root.
+    *       Otherwise the message is reduced modulo the generator with 
+    *       this parity matrix first, and only the remainder gets 
+    *       evaluated. A clean message has no remainder, so checking one
+    *       costs about the same as encoding it. It has to be for the 
+    *       same field and generator, and at least as long as the data.
     * @return 0 if the operation was successful, -1 otherwise
 */
-int rs_calc_syndromes(
+int rs_calc_syndromes(const gf8_field_t* field,
     uint8_t* buffer, uint8_t* message, 
-    int message_length, int generator_length);
+    int message_length, int generator_length,
+    const rs_parity_matrix_t* parity_matrix);
 
 
 /*
@@ -62,4 +318,168 @@ int rs_calc_syndromes(
 int rs_check_if_error(uint8_t* syndromes, 
     int syndromes_length);
 
+/*
+    * Corrects errors in a message in place. Uses Berlekamp-Massey to 
+    * find the error locator, a Chien search for the error positions 
+    * and Forney's formula for the error values. A single error is 
+    * spotted from the syndromes alone and fixed without any of that.
+    * @param field Field to work in
+    * @param message Message to correct, including the parity
+    * @param message_length Length of the message, including the parity
+    * @param syndromes Syndromes of the message from rs_calc_syndromes
+    * @param generator_length Length of the generator polynomial
+    * @param working_buffer Needs to be at least 
+    *       RS_DECODE_BUFFER_SIZE(generator_length)
+    * @return Number of symbols corrected, 0 if there were no errors, 
+    *       or -1 if there are too many errors to correct. Up to
+    *       (generator_length - 1) / 2 errors can be corrected.
+    *       The message isn't modified if it returns -1.
+*/
+int rs_decode(const gf8_field_t* field, 
+    uint8_t* message, int message_length, 
+    const uint8_t* syndromes, int generator_length, 
+    uint8_t* working_buffer);
+
+/*
+    * Corrects errors and erasures in a message in place. Erasures are 
+    * symbols already known to be bad, like ones from a failed read. 
+    * They only cost one parity symbol each instead of two, so it can 
+    * correct any mix where 2 * errors + erasures <= generator_length - 1.
+    * If the syndromes show nothing but the erasures are wrong it skips
+    * straight to working out their values.
+    * @param field Field to work in
+    * @param message Message to correct, including the parity
+    * @param message_length Length of the message, including the parity
+    * @param syndromes Syndromes of the message from rs_calc_syndromes
+    * @param generator_length Length of the generator polynomial
+    * @param erasures Indexes into message of the erased symbols
+    * @param erasure_count Number of erasures, up to generator_length - 1
+    * @param working_buffer Needs to be at least 
+    *       RS_DECODE_BUFFER_SIZE(generator_length)
+    * @return Number of symbols corrected, 0 if there were no errors, 
+    *       or -1 if there are too many errors to correct. 
+    *       The message isn't modified if it returns -1.
+*/
+int rs_decode_erasures(const gf8_field_t* field, 
+    uint8_t* message, int message_length, 
+    const uint8_t* syndromes, int generator_length, 
+    const int* erasures, int erasure_count, 
+    uint8_t* working_buffer);
+
+/*
+    * Checks for exactly one bad symbol straight from the syndromes, 
+    * which is almost every bad codeword, and works out where it is and 
+    * what to XOR it with. Costs one table lookup per syndrome.
+    * @param field Field to work in
+    * @param syndromes Syndromes without the leading 0, at the roots
+    *       alpha^(prim * (fcr + i))
+    * @param number_of_symbols Number of syndromes
+    * @param fcr First consecutive root
+    * @param prim Power of alpha between roots
+    * @param degree Gets the degree of the bad symbol, counted from the 
+    *       end of the codeword. Can be past the end if it's really a 
+    *       bigger error.
+    * @param magnitude Gets the value to XOR into it
+    * @return 1 if it's a single error, 0 if not
+*/
+int rs_decode_single_error(const gf8_field_t* field, 
+    const uint8_t* syndromes, int number_of_symbols, int fcr, int prim, 
+    int* degree, uint8_t* magnitude);
+
+/*
+    * Gets the size of the memory a codec needs
+    * @param n Codeword length
+    * @param k Data length
+    * @param slices Bytes the table encoder consumes per step, or 0 for 
+    *       no table. The parity matrix is always counted.
+    * @return Size of the memory in bytes, 0 if the parameters are bad
+*/
+size_t rs_codec_memory_size(int n, int k, int slices);
+
+/*
+    * Sets up a codec. Works out the generator, its logs, the roots, 
+    * the parity matrix and the encoder table once so none of the calls 
+    * after need them.
+    * @param codec Codec to initialize
+    * @param field Field to work in
+    * @param n Codeword length, up to 255
+    * @param k Data length, 1 to n - 1
+    * @param fcr First consecutive root as a power of alpha, 0 to 254
+    * @param prim Step between the roots as a power of alpha. Has to be
+    *       coprime with 255.
+    * @param memory Needs to be at least rs_codec_memory_size(n, k, slices)
+    *       It belongs to the codec afterwards.
+    * @param slices Bytes the table encoder consumes per step, 0 to
+    *       RS_ENCODER_MAX_SLICES and at most n - k. With 0 there's no 
+    *       table, and it encodes and checks with the parity matrix.
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_codec_init(rs_codec_t* codec, const gf8_field_t* field, 
+    int n, int k, int fcr, int prim, uint8_t* memory, int slices);
+
+/*
+    * Encodes k bytes of data
+    * @param codec Codec to use
+    * @param data Data to encode, k bytes
+    * @param parity Gets the n - k parity bytes. Doesn't have to be 
+    *       next to the data.
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_codec_encode(const rs_codec_t* codec, const uint8_t* data, 
+    uint8_t* parity);
+
+/*
+    * Updates the parity for a write to part of the data, without 
+    * encoding it all again. Each byte written costs one pass over the 
+    * parity.
+    * @param codec Codec to use
+    * @param parity Parity of the data before the write, n - k bytes. 
+    *       Gets the parity of the data after it.
+    * @param offset Where in the data the write starts
+    * @param old_bytes What was there before the write
+    * @param new_bytes What's there after the write
+    * @param length Length of the write. offset + length can't be 
+    *       more than k.
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs_update_parity(const rs_codec_t* codec, uint8_t* parity, 
+    int offset, const uint8_t* old_bytes, const uint8_t* new_bytes, 
+    int length);
+
+/*
+    * Checks if data and its parity make up a clean codeword
+    * @param codec Codec to use
+    * @param data Data, k bytes
+    * @param parity Parity, n - k bytes
+    * @return 0 if there are no errors, 1 if there are
+*/
+int rs_codec_check(const rs_codec_t* codec, const uint8_t* data, 
+    const uint8_t* parity);
+
+/*
+    * Corrects errors in data and its parity in place
+    * @param codec Codec to use
+    * @param data Data, k bytes
+    * @param parity Parity, n - k bytes
+    * @return Number of symbols corrected, 0 if there were no errors, 
+    *       or -1 if there are too many errors to correct. 
+    *       Neither is modified if it returns -1.
+*/
+int rs_codec_decode(rs_codec_t* codec, uint8_t* data, uint8_t* parity);
+
+/*
+    * Corrects errors and erasures in data and its parity in place
+    * @param codec Codec to use
+    * @param data Data, k bytes
+    * @param parity Parity, n - k bytes
+    * @param erasures Indexes of the erased symbols, 0 to k - 1 for the
+    *       data and k to n - 1 for the parity
+    * @param erasure_count Number of erasures, up to n - k
+    * @return Number of symbols corrected, 0 if there were no errors, 
+    *       or -1 if there are too many errors to correct. 
+    *       Neither is modified if it returns -1.
+*/
+int rs_codec_decode_erasures(rs_codec_t* codec, uint8_t* data, 
+    uint8_t* parity, const int* erasures, int erasure_count);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "rs_ec_16.h"
+
+int rs16_generator_polynomial(const gf16_field_t* field, uint16_t* buffer, 
+    int generator_length)
+{
+    if(generator_length < 1 || generator_length > GF16_ORDER) {
+        return -1;
+    }
+
+    // Start with g(x) = 1 and zero out the rest
+    buffer[0] = 1;
+    for(int i = 1; i < generator_length; i++) {
+        buffer[i] = 0;
+    }
+
+    // Multiply in (x - alpha^i) one root at a time. Going from the 
+    // back lets us do it in place, so no working buffer.
+    int number_of_symbols = generator_length - 1;
+    for(int i = 0; i < number_of_symbols; i++) {
+        uint16_t root = field->exp[i];
+        for(int j = i + 1; j > 0; j--) {
+            buffer[j] ^= gf16_mul(field, buffer[j - 1], root);
+        }
+    }
+    return 0;
+}
+
+int rs16_encode(const gf16_field_t* field,
+    uint16_t* buffer, const uint16_t* message, int message_length, 
+    const uint16_t* generator_polynomial, int generator_length)
+{
+    // The whole codeword has to fit in the field
+    int buffer_size = message_length + generator_length - 1;
+    if(message_length <= 0 || generator_length < 2 || 
+        buffer_size > GF16_ORDER) {
+        return -1;
+    }
+
+    // Copy the message over if we aren't encoding in place
+    if(buffer != message) {
+        for(int i = 0; i < message_length; i++) {
+            buffer[i] = message[i];
+        }
+    }
+
+    // The remainder is built right where it ends up, after the message.
+    // This is the usual LFSR: feed back (message ^ top of the remainder)
+    // through the generator and shift.
+    int number_of_symbols = generator_length - 1;
+    uint16_t* remainder = buffer + message_length;
+    for(int i = 0; i < number_of_symbols; i++) {
+        remainder[i] = 0;
+    }
+
+    for(int i = 0; i < message_length; i++) {
+        uint16_t feedback = message[i] ^ remainder[0];
+        for(int j = 0; j < number_of_symbols - 1; j++) {
+            remainder[j] = remainder[j + 1];
+        }
+        remainder[number_of_symbols - 1] = 0;
+        gf16_region_mul_xor(field, remainder, generator_polynomial + 1, 
+            feedback, number_of_symbols);
+    }
+    return 0;
+}
+
+int rs16_calc_syndromes(const gf16_field_t* field,
+    uint16_t* buffer, const uint16_t* message, 
+    int message_length, int generator_length)
+{
+    if(message_length <= 0 || message_length > GF16_ORDER || 
+        generator_length < 1) {
+        return -1;
+    }
+
+    // First term is always 0, same as rs_calc_syndromes
+    buffer[0] = 0;
+    for(int i = 0; i < generator_length - 1; i++) {
+        buffer[i + 1] = gf16_poly_eval(field, message, 
+            field->exp[i], message_length);
+    }
+    return 0;
+}
+
+int rs16_check_if_error(const uint16_t* syndromes, int syndromes_length)
+{
+    // Check if any of the syndromes are non-zero
+    for(int i = 0; i < syndromes_length; i++) {
+        if(syndromes[i] != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,65 @@
+#ifndef _RS_EC_16_H_
+#define _RS_EC_16_H_
+
+#include <stdint.h>
+#include "galois_field_16.h"
+
+/*
+ * Reed-Solomon over GF(2^16). Works the same way as rs_ec.h 
+ * (highest order first, roots alpha^0 .. alpha^(nsym-1), 
+ * syndromes[0] is always 0) but with 16 bit symbols, so 
+ * message_length + generator_length - 1 can go up to 65535.
+ */
+
+/*
+    * Computes a generator polynomial for a Reed-Solomon code
+    * @param field Field to work in
+    * @param buffer Needs to be at least the size of generator_length
+    * @param generator_length Size of the buffer to fill
+    *   !!NOTE that this will create (generator_length - 1) symbols
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs16_generator_polynomial(const gf16_field_t* field, uint16_t* buffer, 
+    int generator_length);
+
+/*
+    * Encodes a message using a Reed-Solomon code
+    * @param field Field to work in
+    * @param buffer Needs to be at least the size of
+    *       (message_length + generator_length - 1)
+    *       Can be the same as message.
+    * @param message Message to encode
+    * @param message_length Length of the message
+    * @param generator_polynomial Generator polynomial to use
+    * @param generator_length Length of the generator polynomial
+    * @return 0 if the operation was successful, -1 otherwise
+    * 
+    * @note The buffer will contain the message followed 
+    *   by the RS code.
+*/
+int rs16_encode(const gf16_field_t* field,
+    uint16_t* buffer, const uint16_t* message, int message_length, 
+    const uint16_t* generator_polynomial, int generator_length);
+
+/*
+    * Calculates the syndromes of a message
+    * @param field Field to work in
+    * @param buffer Needs to be at least the size of generator_length
+    * @param message Message to calculate the syndromes of
+    * @param message_length Length of the message
+    * @param generator_length Length of the generator polynomial
+    * @return 0 if the operation was successful, -1 otherwise
+*/
+int rs16_calc_syndromes(const gf16_field_t* field,
+    uint16_t* buffer, const uint16_t* message, 
+    int message_length, int generator_length);
+
+/*
+    * Checks if there are any errors in the message
+    * @param syndromes The syndromes to check
+    * @param syndromes_length Length of the syndromes
+    * @return 0 if there are no errors, 1 otherwise
+*/
+int rs16_check_if_error(const uint16_t* syndromes, int syndromes_length);
+
+#endif
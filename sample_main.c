@@ -1,6 +1,10 @@
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include "rs_ec.h"
+#include "rs_ec_16.h"
+#include "rs_bitslice.h"
+#include "ecc_buffers.h"
 #include <time.h>
 
 // The sum of these need to be under 2^8 = 256
@@ -11,6 +15,289 @@
 // Set this at least double MESSAGE_SIZE+SYMBOL_SIZE to be safe
 #define BUFFER_SIZE (MESSAGE_SIZE*2 + SYMBOL_SIZE*2)
 
+// GF(2^16) codewords can be much longer, up to 65535 symbols
+#define MESSAGE_SIZE_16 4064
+#define SYMBOL_SIZE_16 33
+
+// These are too big for the stack
+static gf16_field_t field_16;
+static uint16_t buffer_16[MESSAGE_SIZE_16 + SYMBOL_SIZE_16];
+static uint16_t message_buffer_16[MESSAGE_SIZE_16];
+
+// The bitsliced encoder does a full batch of codewords at a time
+static rs_bitslice_encoder_t bitslice_encoder;
+static uint8_t bitslice_codewords[RS_BITSLICE_LANES * BUFFER_SIZE];
+static uint64_t bitslice_planes[RS_BITSLICE_PLANES(BUFFER_SIZE)];
+static uint8_t bitslice_corrupted[RS_BITSLICE_LANES * BUFFER_SIZE];
+static uint64_t bitslice_decode_planes[
+    RS_BITSLICE_DECODE_PLANES(SYMBOL_SIZE)];
+
+// Table encoder, up to RS_ENCODER_MAX_SLICES slices of 256 rows. 
+// The 31 parity symbols get padded out to 32 byte rows.
+static uint8_t encoder_table[RS_ENCODER_MAX_SLICES * 256 * 32];
+
+// Parity matrix for the code comparison, k rows of up to 32 bytes
+static uint8_t parity_matrix_buffer[255 * 32];
+
+// Codecs for the code comparison and the batch decoder. Each one checks 
+// it fits with rs_codec_memory_size before using it.
+static uint8_t codec_memory[128 * 1024];
+
+// Protected buffer for its benchmark, with room for the parity and 
+// bookkeeping
+#define ECC_SAMPLE_SIZE (8 * 1024 * 1024)
+static uint8_t ecc_memory[ECC_SAMPLE_SIZE / 223 * 272 + 65536] 
+    __attribute__((aligned(ECC_BUFFER_ALIGN)));
+static uint8_t ecc_data[ECC_SAMPLE_SIZE];
+
+// Working space for rs_decode
+static uint8_t decode_working_buffer[RS_DECODE_BUFFER_SIZE(SYMBOL_SIZE)];
+
+// Prints how fast a run of encodes went
+static void print_rate(const char* name, clock_t begin, clock_t end, 
+    int sample_size, int data_size)
+{
+    double time_spent = (double)(end - begin) / CLOCKS_PER_SEC;
+    double time_per_encode = time_spent / sample_size;
+    double data_per_second = data_size / time_per_encode;
+    double data_per_second_mbps = data_per_second / 1000000;
+    printf("  %-16s %10.2f MB/s\n", name, data_per_second_mbps);
+}
+
+// Times one (n, k) code with the division, table and parity 
+// matrix encoders, the streaming encoder, and the codec's encode, check and decode
+static void benchmark_code(const gf8_field_t* field, int n, int k)
+{
+    uint8_t buffer[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    uint8_t generator[BUFFER_SIZE] = {0};
+    uint8_t message[BUFFER_SIZE] = {0};
+    int generator_length = n - k + 1;
+    int sample_size = 25000;
+
+    for(int i = 0; i < k; i++) {
+        message[i] = (uint8_t)(i * 7 + 1);
+    }
+    rs_generator_polynomial(field, generator, working_buffer, 
+        generator_length);
+    printf("RS(%d, %d):\n", n, k);
+
+    clock_t begin = clock();
+    for(int i = 0; i < sample_size; i++) {
+        rs_encode(field, buffer, working_buffer, message, k, 
+            generator, generator_length);
+    }
+    print_rate("rs_encode", begin, clock(), sample_size, n);
+
+    // Same division, but only the parity gets written
+    begin = clock();
+    for(int i = 0; i < sample_size; i++) {
+        rs_encode_parity(field, buffer + k, message, k, 
+            generator, generator_length);
+    }
+    print_rate("rs_encode_parity", begin, clock(), sample_size, n);
+
+    rs_encoder_t encoder;
+    rs_encoder_init(field, &encoder, encoder_table, generator, 
+        generator_length, RS_ENCODER_MAX_SLICES);
+    begin = clock();
+    for(int i = 0; i < sample_size; i++) {
+        rs_encoder_encode(&encoder, buffer, message, k);
+    }
+    print_rate("table (by 8)", begin, clock(), sample_size, n);
+
+    // Same table, fed in network sized pieces
+    rs_encoder_state_t state;
+    begin = clock();
+    for(int i = 0; i < sample_size; i++) {
+        rs_encoder_state_init(&state, &encoder);
+        for(int offset = 0; offset < k; offset += 64) {
+            int length = (k - offset < 64) ? k - offset : 64;
+            rs_encoder_state_update(&state, message + offset, length);
+        }
+        rs_encoder_state_finalize(&state, buffer + k);
+    }
+    print_rate("streamed (64 B)", begin, clock(), sample_size, n);
+
+    rs_parity_matrix_t parity_matrix;
+    rs_parity_matrix_init(field, &parity_matrix, parity_matrix_buffer, 
+        generator, generator_length, k);
+    begin = clock();
+    for(int i = 0; i < sample_size; i++) {
+        rs_parity_matrix_encode(&parity_matrix, buffer, message, k);
+    }
+    print_rate("parity matrix", begin, clock(), sample_size, n);
+
+    rs_codec_t codec;
+    if(rs_codec_memory_size(n, k, RS_ENCODER_MAX_SLICES) > 
+        sizeof(codec_memory) || rs_codec_init(&codec, field, n, k, 0, 1, 
+        codec_memory, RS_ENCODER_MAX_SLICES) != 0) {
+        printf("codec init failed.\n");
+        return;
+    }
+    uint8_t* parity = buffer + k;
+    begin = clock();
+    for(int i = 0; i < sample_size; i++) {
+        rs_codec_encode(&codec, message, parity);
+    }
+    print_rate("codec encode", begin, clock(), sample_size, n);
+
+    int errors = 0;
+    begin = clock();
+    for(int i = 0; i < sample_size; i++) {
+        errors += rs_codec_check(&codec, message, parity);
+    }
+    print_rate("codec check", begin, clock(), sample_size, n);
+
+    // One bad symbol, fixed and put back every time
+    begin = clock();
+    for(int i = 0; i < sample_size; i++) {
+        message[i % k] ^= 0x5A;
+        if(rs_codec_decode(&codec, message, parity) != 1) {
+            errors++;
+        }
+    }
+    print_rate("codec decode", begin, clock(), sample_size, n);
+
+    // One byte writes patched into the parity. The rate counts only the
+    // byte written, a full encode would redo the whole codeword.
+    begin = clock();
+    for(int i = 0; i < sample_size; i++) {
+        uint8_t old_byte = message[i % k];
+        message[i % k] ^= 0x5A;
+        rs_update_parity(&codec, parity, i % k, &old_byte, 
+            &message[i % k], 1);
+    }
+    print_rate("codec 1 B update", begin, clock(), sample_size, 1);
+    errors += rs_codec_check(&codec, message, parity);
+    if(errors != 0) {
+        printf("  %d codec failures\n", errors);
+    }
+}
+
+// Times whole buffer writes and reads of an ecc_buffer, then small 
+// ones scattered over it
+static void benchmark_ecc_buffer(void)
+{
+    ecc_buffer_t* buffer;
+    if(ecc_buffer_memory_size(ECC_SAMPLE_SIZE) > sizeof(ecc_memory) ||
+        ecc_buffer_init(&buffer, ecc_memory, ECC_SAMPLE_SIZE) != 0) {
+        printf("ecc_buffer init failed.\n");
+        return;
+    }
+    for(int i = 0; i < ECC_SAMPLE_SIZE; i++) {
+        ecc_data[i] = (uint8_t)(i * 13 + 5);
+    }
+    printf("ecc_buffer (%d MB):\n", ECC_SAMPLE_SIZE / (1024 * 1024));
+
+    int passes = 10;
+    clock_t begin = clock();
+    for(int i = 0; i < passes; i++) {
+        ecc_buffer_set(buffer, 0, ecc_data, ECC_SAMPLE_SIZE);
+    }
+    print_rate("set", begin, clock(), passes, ECC_SAMPLE_SIZE);
+
+    // A new epoch every pass so every chunk gets checked, then without
+    // so it's just the copy
+    int failures = 0;
+    begin = clock();
+    for(int i = 0; i < passes; i++) {
+        ecc_buffer_new_epoch(buffer);
+        failures += ecc_buffer_get(buffer, 0, ecc_data, ECC_SAMPLE_SIZE) != 0;
+    }
+    print_rate("get", begin, clock(), passes, ECC_SAMPLE_SIZE);
+
+    begin = clock();
+    for(int i = 0; i < passes; i++) {
+        failures += ecc_buffer_get(buffer, 0, ecc_data, ECC_SAMPLE_SIZE) != 0;
+    }
+    print_rate("get (hot)", begin, clock(), passes, ECC_SAMPLE_SIZE);
+
+    // Same checks without the copy
+    begin = clock();
+    for(int i = 0; i < passes; i++) {
+        ecc_buffer_new_epoch(buffer);
+        failures += ecc_buffer_view(buffer, 0, ECC_SAMPLE_SIZE) == 0;
+    }
+    print_rate("view", begin, clock(), passes, ECC_SAMPLE_SIZE);
+
+    // 64 byte reads and writes all over the place. Each read checks at
+    // most the chunks it lands in.
+    int sample_size = 250000;
+    uint32_t offset = 1;
+    uint8_t small[64];
+    ecc_buffer_new_epoch(buffer);
+    begin = clock();
+    for(int i = 0; i < sample_size; i++) {
+        offset = offset * 1103515245u + 12345u;
+        failures += ecc_buffer_get(buffer, offset % (ECC_SAMPLE_SIZE - 64), 
+            small, 64) != 0;
+    }
+    print_rate("get (64 B)", begin, clock(), sample_size, 64);
+
+    uint32_t sum = 0;
+    begin = clock();
+    for(int i = 0; i < sample_size; i++) {
+        offset = offset * 1103515245u + 12345u;
+        const data_t* view = ecc_buffer_view(buffer, 
+            offset % (ECC_SAMPLE_SIZE - 64), 64);
+        failures += view == 0;
+        sum += view ? view[0] : 0;
+    }
+    print_rate("view (64 B)", begin, clock(), sample_size, 64);
+
+    begin = clock();
+    for(int i = 0; i < sample_size; i++) {
+        offset = offset * 1103515245u + 12345u;
+        failures += ecc_buffer_set(buffer, offset % (ECC_SAMPLE_SIZE - 64), 
+            small, 64) != 0;
+    }
+    print_rate("set (64 B)", begin, clock(), sample_size, 64);
+
+    // Same writes in write-back mode, flush included
+    ecc_write_back_config_t write_back = { 0, -1 };
+    ecc_buffer_write_back_start(buffer, &write_back);
+    begin = clock();
+    for(int i = 0; i < sample_size; i++) {
+        offset = offset * 1103515245u + 12345u;
+        failures += ecc_buffer_set(buffer, offset % (ECC_SAMPLE_SIZE - 64), 
+            small, 64) != 0;
+    }
+    ecc_buffer_write_back_stop(buffer);
+    print_rate("write-back (64 B)", begin, clock(), sample_size, 64);
+
+    // What one scrubber pass costs, then how reads fare with one running
+    // flat out alongside them
+    uint64_t chunks = (ECC_SAMPLE_SIZE + ECC_BUFFER_DATA_SIZE - 1) / 
+        ECC_BUFFER_DATA_SIZE;
+    begin = clock();
+    for(int i = 0; i < passes; i++) {
+        failures += ecc_buffer_scrub(buffer, 0, chunks) != 0;
+    }
+    print_rate("scrub", begin, clock(), passes, ECC_SAMPLE_SIZE);
+
+    ecc_scrubber_config_t config = { 0, -1 };
+    ecc_buffer_scrubber_start(buffer, &config);
+    begin = clock();
+    for(int i = 0; i < sample_size; i++) {
+        offset = offset * 1103515245u + 12345u;
+        failures += ecc_buffer_get(buffer, offset % (ECC_SAMPLE_SIZE - 64), 
+            small, 64) != 0;
+    }
+    clock_t end = clock();
+    ecc_buffer_scrubber_stop(buffer);
+    // clock() counts the scrubber's time too
+    print_rate("get (64 B, scrub)", begin, end, sample_size, 64);
+    // Keeps the views from being optimized away
+    if(sum == 1) {
+        printf(" ");
+    }
+    if(failures != 0) {
+        printf("  %d ecc_buffer failures\n", failures);
+    }
+    ecc_buffer_free(buffer);
+}
+
 int main()
 {
     // All the memory we need for the entire application
@@ -21,19 +308,25 @@ int main()
 
     int rs_chunk_size = MESSAGE_SIZE + SYMBOL_SIZE - 1;
 
+    // Work in the usual 0x11D field
+    const gf8_field_t* field = &gf8_field_default;
+
     // Copy the message to the message buffer
     uint8_t message[] = "Test Message!";
     for(int i = 0; i < (int)sizeof(message); i++) {
         message_buffer[i] = message[i];
     }
 
+    printf("Using %s region kernels\n", 
+        gf8_region_impl_name(gf8_region_impl()));
+
     // Generate the generator polynomial
     printf("Generating Generator Polynomial\n");
-    rs_generator_polynomial(generator_polynomial_buffer, 
+    rs_generator_polynomial(field, generator_polynomial_buffer, 
         working_buffer, SYMBOL_SIZE);
 
     // Do the actual encoding
-    int result = rs_encode(buffer, working_buffer, 
+    int result = rs_encode(field, buffer, working_buffer, 
         message_buffer, MESSAGE_SIZE, 
         generator_polynomial_buffer, SYMBOL_SIZE);
     
@@ -50,8 +343,8 @@ int main()
 
     // Calculate the syndromes
     printf("\nCalculating Syndromes\n");
-    result = rs_calc_syndromes(working_buffer, buffer, 
-        rs_chunk_size, SYMBOL_SIZE);
+    result = rs_calc_syndromes(field, working_buffer, buffer, 
+        rs_chunk_size, SYMBOL_SIZE, 0);
     if(result != 0) {
         printf("syndrome calculation failed.\n");
         return 1;
@@ -78,8 +371,8 @@ int main()
 
     // Calculate the syndromes
     printf("Calculating Syndromes\n");
-    result = rs_calc_syndromes(working_buffer, buffer, 
-        rs_chunk_size, SYMBOL_SIZE);
+    result = rs_calc_syndromes(field, working_buffer, buffer, 
+        rs_chunk_size, SYMBOL_SIZE, 0);
     if(result != 0) {
         printf("syndrome calculation failed.\n");
         return 1;
@@ -108,7 +401,7 @@ int main()
         int data_size = MESSAGE_SIZE + SYMBOL_SIZE;
         clock_t begin = clock();
         for(int i = 0; i < sample_size; i++) {
-            rs_encode(buffer, working_buffer, 
+            rs_encode(field, buffer, working_buffer, 
                 message_buffer, MESSAGE_SIZE, 
                 generator_polynomial_buffer, SYMBOL_SIZE);
         }
@@ -123,6 +416,40 @@ int main()
         printf("Data per second encoded: %f MB/s\n", data_per_second_mbps);
     }
 
+    // Same thing with the table encoder
+    int slice_counts[] = { 1, 4, 8 };
+    for(int s = 0; s < 3; s++) {
+        rs_encoder_t encoder;
+        rs_encoder_init(field, &encoder, encoder_table, 
+            generator_polynomial_buffer, SYMBOL_SIZE, slice_counts[s]);
+
+        printf("Benchmarking rs_encoder_encode (slice-by-%d)..\n", 
+            slice_counts[s]);
+        int sample_size = 25000;
+        int data_size = MESSAGE_SIZE + SYMBOL_SIZE;
+        clock_t begin = clock();
+        for(int i = 0; i < sample_size; i++) {
+            rs_encoder_encode(&encoder, buffer, message_buffer, MESSAGE_SIZE);
+        }
+        clock_t end = clock();
+
+        double time_spent = (double)(end - begin) / CLOCKS_PER_SEC;
+        double time_per_encode = time_spent / sample_size;
+        double data_per_second = data_size / time_per_encode;
+        double data_per_second_mbps = data_per_second / 1000000;
+
+        printf("Time spent: %f s\n", time_spent);
+        printf("Data per second encoded: %f MB/s\n", data_per_second_mbps);
+    }
+
+    // Division vs table vs parity matrix on a few common codes
+    benchmark_code(field, 255, 223);
+    benchmark_code(field, 255, 239);
+    benchmark_code(field, 204, 188);
+
+    // Small records as a shortened code, nothing padded out to 255
+    benchmark_code(field, 48, 40);
+
     // Restore the buffer
     buffer[0] = 'T';
 
@@ -142,8 +469,8 @@ int main()
         int data_size = MESSAGE_SIZE + SYMBOL_SIZE;
         clock_t begin = clock();
         for(int i = 0; i < sample_size; i++) {
-            rs_calc_syndromes(working_buffer, buffer, 
-                rs_chunk_size, SYMBOL_SIZE);
+            rs_calc_syndromes(field, working_buffer, buffer, 
+                rs_chunk_size, SYMBOL_SIZE, 0);
         }
         clock_t end = clock();
         
@@ -156,5 +483,258 @@ int main()
         printf("Data per second encoded: %f MB/s\n", data_per_second_mbps);
     }
 
+    // Reducing modulo the generator with the parity matrix first, which
+    // is all a clean codeword needs
+    {
+        rs_parity_matrix_t parity_matrix;
+        rs_parity_matrix_init(field, &parity_matrix, parity_matrix_buffer, 
+            generator_polynomial_buffer, SYMBOL_SIZE, MESSAGE_SIZE);
+
+        printf("Benchmarking rs_calc_syndromes (parity matrix)..\n");
+        int sample_size = 25000;
+        int data_size = MESSAGE_SIZE + SYMBOL_SIZE;
+        int errors = 0;
+        clock_t begin = clock();
+        for(int i = 0; i < sample_size; i++) {
+            rs_calc_syndromes(field, working_buffer, buffer, 
+                rs_chunk_size, SYMBOL_SIZE, &parity_matrix);
+            errors += rs_check_if_error(working_buffer, SYMBOL_SIZE) != 0;
+        }
+        clock_t end = clock();
+
+        double time_spent = (double)(end - begin) / CLOCKS_PER_SEC;
+        double time_per_encode = time_spent / sample_size;
+        double data_per_second = data_size / time_per_encode;
+        double data_per_second_mbps = data_per_second / 1000000;
+
+        printf("Time spent: %f s (%d errors)\n", time_spent, errors);
+        printf("Data per second checked: %f MB/s\n", data_per_second_mbps);
+    }
+
+    // Full decode with 0, 1, t/2 and t errors. Each pass starts from the
+    // same corrupted copy so the syndromes have to be redone every time.
+    {
+        uint8_t corrupted[BUFFER_SIZE];
+        uint8_t decode_buffer[BUFFER_SIZE];
+        uint8_t syndromes[SYMBOL_SIZE];
+        int max_errors = (SYMBOL_SIZE - 1) / 2;
+        int error_counts[] = { 0, 1, max_errors / 2, max_errors };
+        for(int c = 0; c < 4; c++) {
+            for(int i = 0; i < rs_chunk_size; i++) {
+                corrupted[i] = buffer[i];
+            }
+            // Spread the errors out over the whole codeword
+            for(int e = 0; e < error_counts[c]; e++) {
+                corrupted[(e * 17 + 3) % rs_chunk_size] ^= (uint8_t)(e + 1);
+            }
+
+            printf("Benchmarking rs_decode (%d errors)..\n", 
+                error_counts[c]);
+            int sample_size = 25000;
+            int data_size = MESSAGE_SIZE + SYMBOL_SIZE;
+            int failures = 0;
+            clock_t begin = clock();
+            for(int i = 0; i < sample_size; i++) {
+                memcpy(decode_buffer, corrupted, rs_chunk_size);
+                rs_calc_syndromes(field, syndromes, decode_buffer, 
+                    rs_chunk_size, SYMBOL_SIZE, 0);
+                if(rs_decode(field, decode_buffer, rs_chunk_size, syndromes, 
+                    SYMBOL_SIZE, decode_working_buffer) != error_counts[c]) {
+                    failures++;
+                }
+            }
+            clock_t end = clock();
+
+            double time_spent = (double)(end - begin) / CLOCKS_PER_SEC;
+            double time_per_encode = time_spent / sample_size;
+            double data_per_second = data_size / time_per_encode;
+            double data_per_second_mbps = data_per_second / 1000000;
+
+            printf("Time spent: %f s (%d failures)\n", time_spent, failures);
+            printf("Data per second decoded: %f MB/s\n", 
+                data_per_second_mbps);
+        }
+    }
+
+    // All of the parity spent on erasures, which never needs 
+    // Berlekamp-Massey or the Chien search
+    {
+        uint8_t corrupted[BUFFER_SIZE];
+        uint8_t decode_buffer[BUFFER_SIZE];
+        uint8_t syndromes[SYMBOL_SIZE];
+        int erasures[SYMBOL_SIZE - 1];
+        for(int i = 0; i < rs_chunk_size; i++) {
+            corrupted[i] = buffer[i];
+        }
+        for(int e = 0; e < SYMBOL_SIZE - 1; e++) {
+            erasures[e] = (e * 7 + 5) % rs_chunk_size;
+            corrupted[erasures[e]] = 0;
+        }
+
+        printf("Benchmarking rs_decode_erasures (%d erasures)..\n", 
+            SYMBOL_SIZE - 1);
+        int sample_size = 25000;
+        int data_size = MESSAGE_SIZE + SYMBOL_SIZE;
+        int failures = 0;
+        clock_t begin = clock();
+        for(int i = 0; i < sample_size; i++) {
+            memcpy(decode_buffer, corrupted, rs_chunk_size);
+            rs_calc_syndromes(field, syndromes, decode_buffer, 
+                rs_chunk_size, SYMBOL_SIZE, 0);
+            if(rs_decode_erasures(field, decode_buffer, rs_chunk_size, 
+                syndromes, SYMBOL_SIZE, erasures, SYMBOL_SIZE - 1, 
+                decode_working_buffer) < 0) {
+                failures++;
+            }
+        }
+        clock_t end = clock();
+
+        double time_spent = (double)(end - begin) / CLOCKS_PER_SEC;
+        double time_per_encode = time_spent / sample_size;
+        double data_per_second = data_size / time_per_encode;
+        double data_per_second_mbps = data_per_second / 1000000;
+
+        printf("Time spent: %f s (%d failures)\n", time_spent, failures);
+        printf("Data per second decoded: %f MB/s\n", data_per_second_mbps);
+    }
+
+    // Same code, but RS_BITSLICE_LANES codewords at a time
+    {
+        printf("Benchmarking rs_bitslice_encode_batch..\n");
+        rs_bitslice_init(field, &bitslice_encoder, 
+            generator_polynomial_buffer, SYMBOL_SIZE);
+        for(int l = 0; l < RS_BITSLICE_LANES; l++) {
+            for(int i = 0; i < MESSAGE_SIZE; i++) {
+                bitslice_codewords[l * rs_chunk_size + i] = 
+                    message_buffer[i];
+            }
+        }
+
+        int sample_size = 25000 / RS_BITSLICE_LANES;
+        int data_size = (MESSAGE_SIZE + SYMBOL_SIZE) * RS_BITSLICE_LANES;
+        clock_t begin = clock();
+        for(int i = 0; i < sample_size; i++) {
+            rs_bitslice_encode_batch(&bitslice_encoder, bitslice_codewords, 
+                rs_chunk_size, MESSAGE_SIZE, RS_BITSLICE_LANES, 
+                bitslice_planes);
+        }
+        clock_t end = clock();
+
+        double time_spent = (double)(end - begin) / CLOCKS_PER_SEC;
+        double time_per_encode = time_spent / sample_size;
+        double data_per_second = data_size / time_per_encode;
+        double data_per_second_mbps = data_per_second / 1000000;
+
+        printf("Time spent: %f s\n", time_spent);
+        printf("Data per second encoded: %f MB/s\n", data_per_second_mbps);
+    }
+
+    // Decode a whole batch of bad codewords at once, every one with the 
+    // same number of errors, then the same codewords one at a time with 
+    // the fastest syndromes and rs_decode
+    {
+        rs_codec_t codec;
+        if(rs_codec_memory_size(rs_chunk_size, MESSAGE_SIZE, 0) > 
+            sizeof(codec_memory) || rs_codec_init(&codec, field, 
+            rs_chunk_size, MESSAGE_SIZE, 0, 1, codec_memory, 0) != 0) {
+            printf("codec init failed.\n");
+            return 1;
+        }
+        rs_parity_matrix_t parity_matrix;
+        rs_parity_matrix_init(field, &parity_matrix, parity_matrix_buffer, 
+            generator_polynomial_buffer, SYMBOL_SIZE, MESSAGE_SIZE);
+        uint8_t syndromes[SYMBOL_SIZE];
+        int results[RS_BITSLICE_LANES];
+        int max_errors = (SYMBOL_SIZE - 1) / 2;
+        int error_counts[] = { 1, 2, max_errors / 2, max_errors };
+        for(int c = 0; c < 4; c++) {
+            for(int l = 0; l < RS_BITSLICE_LANES; l++) {
+                uint8_t* codeword = bitslice_corrupted + l * rs_chunk_size;
+                for(int i = 0; i < MESSAGE_SIZE; i++) {
+                    codeword[i] = (uint8_t)(i * 7 + l);
+                }
+                rs_codec_encode(&codec, codeword, codeword + MESSAGE_SIZE);
+                for(int e = 0; e < error_counts[c]; e++) {
+                    codeword[(l + e * 17 + 3) % rs_chunk_size] ^= 
+                        (uint8_t)(e + 1);
+                }
+            }
+
+            int sample_size = 25000 / RS_BITSLICE_LANES;
+            int data_size = (MESSAGE_SIZE + SYMBOL_SIZE) * RS_BITSLICE_LANES;
+            int failures = 0;
+            clock_t begin = clock();
+            for(int i = 0; i < sample_size; i++) {
+                memcpy(bitslice_codewords, bitslice_corrupted, 
+                    rs_chunk_size * RS_BITSLICE_LANES);
+                rs_decode_batch(&codec, bitslice_codewords, rs_chunk_size, 
+                    RS_BITSLICE_LANES, results, bitslice_decode_planes);
+                for(int l = 0; l < RS_BITSLICE_LANES; l++) {
+                    failures += results[l] != error_counts[c];
+                }
+            }
+            clock_t end = clock();
+            printf("Benchmarking rs_decode_batch (%d errors)..\n", 
+                error_counts[c]);
+            printf("Time spent: %f s (%d failures)\n", 
+                (double)(end - begin) / CLOCKS_PER_SEC, failures);
+            print_rate("batched", begin, end, sample_size, data_size);
+
+            begin = clock();
+            for(int i = 0; i < sample_size; i++) {
+                memcpy(bitslice_codewords, bitslice_corrupted, 
+                    rs_chunk_size * RS_BITSLICE_LANES);
+                for(int l = 0; l < RS_BITSLICE_LANES; l++) {
+                    uint8_t* codeword = bitslice_codewords + 
+                        l * rs_chunk_size;
+                    rs_calc_syndromes(field, syndromes, codeword, 
+                        rs_chunk_size, SYMBOL_SIZE, &parity_matrix);
+                    failures += rs_decode(field, codeword, rs_chunk_size, 
+                        syndromes, SYMBOL_SIZE, decode_working_buffer) != 
+                        error_counts[c];
+                }
+            }
+            print_rate("one at a time", begin, clock(), sample_size, 
+                data_size);
+        }
+    }
+
+    // Same thing with one long GF(2^16) codeword instead of many 
+    // short GF(2^8) ones
+    {
+        printf("Benchmarking rs16_encode (%d+%d symbols)..\n", 
+            MESSAGE_SIZE_16, SYMBOL_SIZE_16 - 1);
+        if(gf16_field_init(&field_16, GF16_POLYNOMIAL_DEFAULT) != 0) {
+            printf("GF(2^16) field init failed.\n");
+            return 1;
+        }
+
+        uint16_t generator_16[SYMBOL_SIZE_16];
+        rs16_generator_polynomial(&field_16, generator_16, SYMBOL_SIZE_16);
+        for(int i = 0; i < MESSAGE_SIZE_16; i++) {
+            message_buffer_16[i] = (uint16_t)(i * 31 + 7);
+        }
+
+        int sample_size = 1000;
+        int data_size = (MESSAGE_SIZE_16 + SYMBOL_SIZE_16 - 1) * 2;
+        clock_t begin = clock();
+        for(int i = 0; i < sample_size; i++) {
+            rs16_encode(&field_16, buffer_16, message_buffer_16, 
+                MESSAGE_SIZE_16, generator_16, SYMBOL_SIZE_16);
+        }
+        clock_t end = clock();
+
+        double time_spent = (double)(end - begin) / CLOCKS_PER_SEC;
+        double time_per_encode = time_spent / sample_size;
+        double data_per_second = data_size / time_per_encode;
+        double data_per_second_mbps = data_per_second / 1000000;
+
+        printf("Time spent: %f s\n", time_spent);
+        printf("Data per second encoded: %f MB/s\n", data_per_second_mbps);
+    }
+
+    // The protected buffer built on all of the above
+    benchmark_ecc_buffer();
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,586 @@
+#include "unity/unity.h"
+#include "ecc_buffers_tests.h"
+#include "../ecc_buffers.h"
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+// Not a multiple of the chunk size, so the last chunk is shortened
+#define BUFFER_SIZE 10000
+
+static uint8_t memory[BUFFER_SIZE * 4] 
+    __attribute__((aligned(ECC_BUFFER_ALIGN)));
+static uint8_t expected[BUFFER_SIZE];
+static uint8_t result[BUFFER_SIZE];
+
+// Simple repeatable pseudo random numbers
+static uint32_t ecc_test_random(uint32_t* state)
+{
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 16;
+}
+
+// Longest a test waits on a background thread before failing
+#define ECC_TEST_TIMEOUT_US (5 * 1000000)
+
+// Microseconds on a clock that only goes forward
+static uint64_t ecc_test_now_us(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+}
+
+// Gives a background thread a moment between polls
+static void ecc_test_nap(void)
+{
+    struct timespec nap = { 0, 1000000 };
+    nanosleep(&nap, 0);
+}
+
+// A buffer filled with random data in one set
+static ecc_buffer_t* ecc_test_buffer(uint32_t* state)
+{
+    ecc_buffer_t* buffer;
+    TEST_ASSERT_TRUE(ecc_buffer_memory_size(BUFFER_SIZE) <= sizeof(memory));
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_init(&buffer, memory, BUFFER_SIZE));
+    for(int i = 0; i < BUFFER_SIZE; i++) {
+        expected[i] = (uint8_t)ecc_test_random(state);
+    }
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_set(buffer, 0, expected, 
+        BUFFER_SIZE));
+    return buffer;
+}
+
+void ecc_buffer_init_tests()
+{
+    ecc_buffer_t* buffer;
+    TEST_ASSERT_EQUAL_INT(0, (int)ecc_buffer_memory_size(0));
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_init(&buffer, memory, 0));
+    // Misaligned
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_init(&buffer, memory + 1, 100));
+
+    // Starts out as zeroes
+    TEST_ASSERT_TRUE(ecc_buffer_memory_size(BUFFER_SIZE) <= sizeof(memory));
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_init(&buffer, memory, BUFFER_SIZE));
+    memset(result, 0xFF, sizeof(result));
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 0, result, BUFFER_SIZE));
+    for(int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_HEX8(0, result[i]);
+    }
+
+    // Out of range, including ones that would overflow
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_get(buffer, 1, result, 
+        BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_set(buffer, UINT64_MAX, result, 
+        2));
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, BUFFER_SIZE, result, 
+        0));
+
+    // Chunks
+    uint8_t* data;
+    uint8_t* parity;
+    int last = (BUFFER_SIZE - 1) / ECC_BUFFER_DATA_SIZE;
+    TEST_ASSERT_EQUAL_INT(ECC_BUFFER_DATA_SIZE, ecc_buffer_chunk(buffer, 
+        0, &data, &parity));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE % ECC_BUFFER_DATA_SIZE, 
+        ecc_buffer_chunk(buffer, last, &data, &parity));
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_chunk(buffer, last + 1, &data, 
+        &parity));
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_free(buffer));
+}
+
+void ecc_buffer_round_trip_tests()
+{
+    uint32_t state = 1;
+    ecc_buffer_t* buffer = ecc_test_buffer(&state);
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 0, result, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, result, BUFFER_SIZE);
+
+    // Writes and reads of every size in random places, some inside one 
+    // chunk and some across several
+    for(int round = 0; round < 500; round++) {
+        uint64_t size = 1 + ecc_test_random(&state) % 600;
+        uint64_t offset = ecc_test_random(&state) % (BUFFER_SIZE - size);
+        uint8_t written[600];
+        for(uint64_t i = 0; i < size; i++) {
+            written[i] = (uint8_t)ecc_test_random(&state);
+        }
+        TEST_ASSERT_EQUAL_INT(0, ecc_buffer_set(buffer, offset, written, 
+            size));
+        memcpy(expected + offset, written, size);
+
+        size = 1 + ecc_test_random(&state) % 600;
+        offset = ecc_test_random(&state) % (BUFFER_SIZE - size);
+        TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, offset, result, 
+            size));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected + offset, result, size);
+    }
+
+    // Every chunk has to still be a clean codeword, which a read of 
+    // everything with no errors can't tell. A single flipped byte in 
+    // each shows it, since it only comes back right if the parity was.
+    int chunk_count = (BUFFER_SIZE + ECC_BUFFER_DATA_SIZE - 1) / 
+        ECC_BUFFER_DATA_SIZE;
+    for(int c = 0; c < chunk_count; c++) {
+        uint8_t* data;
+        uint8_t* parity;
+        ecc_buffer_chunk(buffer, c, &data, &parity);
+        data[0] ^= 0x42;
+    }
+    ecc_buffer_new_epoch(buffer);
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 0, result, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, result, BUFFER_SIZE);
+    ecc_buffer_free(buffer);
+}
+
+void ecc_buffer_correct_tests()
+{
+    uint32_t state = 2;
+    ecc_buffer_t* buffer = ecc_test_buffer(&state);
+
+    // Up to 16 errors in a chunk, data or parity
+    int chunk_count = (BUFFER_SIZE + ECC_BUFFER_DATA_SIZE - 1) / 
+        ECC_BUFFER_DATA_SIZE;
+    for(int c = 0; c < chunk_count; c++) {
+        uint8_t* data;
+        uint8_t* parity;
+        int k = ecc_buffer_chunk(buffer, c, &data, &parity);
+        int errors = c % (ECC_BUFFER_PARITY_SIZE / 2 + 1);
+        for(int e = 0; e < errors; e++) {
+            // 37 steps never land on the same spot twice this soon
+            int position = (e * 37 + c) % (k + ECC_BUFFER_PARITY_SIZE);
+            uint8_t* symbol = (position < k) ? &data[position] : 
+                &parity[position - k];
+            *symbol ^= (uint8_t)(e + 1);
+        }
+    }
+    ecc_buffer_new_epoch(buffer);
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 0, result, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, result, BUFFER_SIZE);
+
+    // The reads fixed the stored copy too
+    uint8_t* data;
+    uint8_t* parity;
+    ecc_buffer_chunk(buffer, 16, &data, &parity);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected + 16 * ECC_BUFFER_DATA_SIZE, 
+        data, ECC_BUFFER_DATA_SIZE);
+
+    // A small write into a chunk with an error keeps the rest of it
+    ecc_buffer_chunk(buffer, 3, &data, &parity);
+    data[100] ^= 0x11;
+    ecc_buffer_new_epoch(buffer);
+    uint8_t written[4] = { 1, 2, 3, 4 };
+    uint64_t offset = 3 * ECC_BUFFER_DATA_SIZE + 10;
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_set(buffer, offset, written, 4));
+    memcpy(expected + offset, written, 4);
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 0, result, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, result, BUFFER_SIZE);
+    ecc_buffer_free(buffer);
+}
+
+void ecc_buffer_lazy_verify_tests()
+{
+    uint32_t state = 4;
+    ecc_buffer_t* buffer = ecc_test_buffer(&state);
+    ecc_buffer_stats_t stats;
+    ecc_buffer_new_epoch(buffer);
+
+    // A read inside one chunk only checks that one
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 500, result, 64));
+    ecc_buffer_stats(buffer, &stats);
+    TEST_ASSERT_EQUAL_UINT64(1, stats.chunks_checked);
+
+    // And across a boundary only the two it covers
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 
+        4 * ECC_BUFFER_DATA_SIZE - 32, result, 64));
+    ecc_buffer_stats(buffer, &stats);
+    TEST_ASSERT_EQUAL_UINT64(3, stats.chunks_checked);
+
+    // Reading them again doesn't check anything
+    for(int i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 500, result, 64));
+    }
+    ecc_buffer_stats(buffer, &stats);
+    TEST_ASSERT_EQUAL_UINT64(3, stats.chunks_checked);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected + 500, result, 64);
+
+    // Neither does a whole chunk that was just written
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_set(buffer, 10 * ECC_BUFFER_DATA_SIZE,
+        expected, ECC_BUFFER_DATA_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 10 * ECC_BUFFER_DATA_SIZE,
+        result, ECC_BUFFER_DATA_SIZE));
+    ecc_buffer_stats(buffer, &stats);
+    TEST_ASSERT_EQUAL_UINT64(3, stats.chunks_checked);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, result, ECC_BUFFER_DATA_SIZE);
+
+    // A new epoch checks them all again, and the error counts add up
+    uint8_t* data;
+    uint8_t* parity;
+    ecc_buffer_chunk(buffer, 2, &data, &parity);
+    data[0] ^= 1;
+    data[1] ^= 1;
+    ecc_buffer_new_epoch(buffer);
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 500, result, 64));
+    ecc_buffer_stats(buffer, &stats);
+    TEST_ASSERT_EQUAL_UINT64(4, stats.chunks_checked);
+    TEST_ASSERT_EQUAL_UINT64(1, stats.chunks_corrected);
+    TEST_ASSERT_EQUAL_UINT64(2, stats.symbols_corrected);
+    TEST_ASSERT_EQUAL_UINT64(0, stats.uncorrectable);
+    ecc_buffer_free(buffer);
+}
+
+void ecc_buffer_uncorrectable_tests()
+{
+    uint32_t state = 3;
+    ecc_buffer_t* buffer = ecc_test_buffer(&state);
+
+    // Way past what the parity can fix
+    uint8_t* data;
+    uint8_t* parity;
+    ecc_buffer_chunk(buffer, 5, &data, &parity);
+    for(int i = 0; i < ECC_BUFFER_DATA_SIZE; i += 2) {
+        data[i] ^= 0xA5;
+    }
+    ecc_buffer_new_epoch(buffer);
+    uint64_t start = 5 * ECC_BUFFER_DATA_SIZE;
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_get(buffer, start, result, 10));
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_set(buffer, start, result, 10));
+    ecc_buffer_stats_t stats;
+    ecc_buffer_stats(buffer, &stats);
+    TEST_ASSERT_EQUAL_UINT64(2, stats.uncorrectable);
+
+    // The chunks around it are fine, and a whole chunk write replaces it
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 0, result, start));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, result, start);
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_set(buffer, start, expected + start, 
+        ECC_BUFFER_DATA_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 0, result, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, result, BUFFER_SIZE);
+    ecc_buffer_free(buffer);
+}
+
+void ecc_buffer_scrub_tests()
+{
+    uint32_t state = 4;
+    ecc_buffer_t* buffer = ecc_test_buffer(&state);
+    ecc_buffer_stats_t stats;
+
+    // Out of range
+    uint64_t chunks = (BUFFER_SIZE + ECC_BUFFER_DATA_SIZE - 1) / 
+        ECC_BUFFER_DATA_SIZE;
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_scrub(buffer, 0, chunks + 1));
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_scrub(buffer, chunks, 1));
+
+    // Errors in chunks that were already checked this epoch, which reads
+    // wouldn't see until the next one. A scrub finds them anyway.
+    uint8_t* data;
+    uint8_t* parity;
+    ecc_buffer_chunk(buffer, 3, &data, &parity);
+    data[7] ^= 0x40;
+    ecc_buffer_chunk(buffer, chunks - 1, &data, &parity);
+    data[0] ^= 0x01;
+    parity[5] ^= 0x80;
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_scrub(buffer, 0, chunks));
+    ecc_buffer_stats(buffer, &stats);
+    TEST_ASSERT_EQUAL_UINT64(chunks, stats.scrubbed_chunks);
+    TEST_ASSERT_EQUAL_UINT64(chunks, stats.chunks_checked);
+    TEST_ASSERT_EQUAL_UINT64(2, stats.chunks_corrected);
+    TEST_ASSERT_EQUAL_UINT64(3, stats.symbols_corrected);
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 0, result, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, result, BUFFER_SIZE);
+
+    // One bad chunk fails the scrub but the rest still get done
+    ecc_buffer_chunk(buffer, 1, &data, &parity);
+    for(int i = 0; i < ECC_BUFFER_DATA_SIZE; i += 2) {
+        data[i] ^= 0xA5;
+    }
+    ecc_buffer_chunk(buffer, 2, &data, &parity);
+    data[9] ^= 0x11;
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_scrub(buffer, 1, 2));
+    ecc_buffer_stats(buffer, &stats);
+    TEST_ASSERT_EQUAL_UINT64(chunks + 2, stats.scrubbed_chunks);
+    TEST_ASSERT_EQUAL_UINT64(3, stats.chunks_corrected);
+    TEST_ASSERT_EQUAL_UINT64(1, stats.uncorrectable);
+    ecc_buffer_free(buffer);
+}
+
+void ecc_buffer_scrubber_tests()
+{
+    uint32_t state = 5;
+    ecc_buffer_t* buffer = ecc_test_buffer(&state);
+    ecc_buffer_stats_t stats;
+    ecc_scrubber_config_t config = { 0, -1 };
+
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_scrubber_stop(buffer));
+    uint8_t* data;
+    uint8_t* parity;
+    uint64_t last = BUFFER_SIZE / ECC_BUFFER_DATA_SIZE;
+    ecc_buffer_chunk(buffer, last, &data, &parity);
+    data[100] ^= 0x0F;
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_scrubber_start(buffer, &config));
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_scrubber_start(buffer, &config));
+
+    // Reads and writes carry on while it runs, until it's been over the 
+    // whole buffer at least twice. They stay out of the last chunk so 
+    // only the scrubber can find the error.
+    uint64_t deadline = ecc_test_now_us() + ECC_TEST_TIMEOUT_US;
+    do {
+        uint64_t offset = ecc_test_random(&state) % 
+            (last * ECC_BUFFER_DATA_SIZE - 300);
+        TEST_ASSERT_EQUAL_INT(0, ecc_buffer_set(buffer, offset, 
+            expected + offset, 300));
+        TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, offset, result, 300));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected + offset, result, 300);
+        ecc_test_nap();
+        ecc_buffer_stats(buffer, &stats);
+    } while(stats.scrub_passes < 2 && ecc_test_now_us() < deadline);
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_scrubber_stop(buffer));
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_scrubber_stop(buffer));
+    if(stats.scrub_passes < 2) {
+        ecc_buffer_free(buffer);
+        TEST_FAIL_MESSAGE("Scrubber didn't get over the buffer twice");
+    }
+
+    ecc_buffer_stats(buffer, &stats);
+    TEST_ASSERT_EQUAL_UINT64(1, stats.chunks_corrected);
+    TEST_ASSERT_EQUAL_UINT64(0, stats.uncorrectable);
+    TEST_ASSERT_TRUE(stats.scrubbed_chunks >= 2 * 45);
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 0, result, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, result, BUFFER_SIZE);
+
+    // Throttled and pinned, and freeing stops it
+    config.bytes_per_second = 1024 * 1024;
+    config.cpu = 0;
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_scrubber_start(buffer, &config));
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 0, result, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_free(buffer));
+}
+
+void ecc_buffer_write_back_tests()
+{
+    uint32_t state = 6;
+    ecc_buffer_t* buffer = ecc_test_buffer(&state);
+    ecc_buffer_stats_t stats;
+    ecc_write_back_config_t config = { 0, -1 };
+
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_write_back_stop(buffer));
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_write_back_start(buffer, &config));
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_write_back_start(buffer, &config));
+
+    // Lots of small writes over the first few chunks, none of which 
+    // encode anything. Only the first write into each chunk checks it.
+    uint8_t* data;
+    uint8_t* parity;
+    ecc_buffer_chunk(buffer, 1, &data, &parity);
+    data[3] ^= 0x22;
+    ecc_buffer_new_epoch(buffer);
+    for(int i = 0; i < 1000; i++) {
+        uint64_t offset = ecc_test_random(&state) % 
+            (4 * ECC_BUFFER_DATA_SIZE - 16);
+        expected[offset] = (uint8_t)ecc_test_random(&state);
+        TEST_ASSERT_EQUAL_INT(0, ecc_buffer_set(buffer, offset, 
+            expected + offset, 16));
+        memcpy(expected + offset + 1, expected + offset, 15);
+        TEST_ASSERT_EQUAL_INT(0, ecc_buffer_set(buffer, offset + 1, 
+            expected + offset + 1, 15));
+    }
+    ecc_buffer_stats(buffer, &stats);
+    TEST_ASSERT_EQUAL_UINT64(4, stats.chunks_checked);
+    TEST_ASSERT_EQUAL_UINT64(1, stats.chunks_corrected);
+    TEST_ASSERT_EQUAL_UINT64(0, stats.chunks_flushed);
+
+    // Reading a chunk flushes it, and flushing the buffer gets the rest
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 0, result, 10));
+    ecc_buffer_stats(buffer, &stats);
+    TEST_ASSERT_EQUAL_UINT64(1, stats.chunks_flushed);
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_flush(buffer));
+    ecc_buffer_stats(buffer, &stats);
+    TEST_ASSERT_EQUAL_UINT64(4, stats.chunks_flushed);
+
+    // The parity it ended up with can fix errors
+    ecc_buffer_chunk(buffer, 2, &data, &parity);
+    data[50] ^= 0x81;
+    ecc_buffer_new_epoch(buffer);
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 0, result, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, result, BUFFER_SIZE);
+
+    // Stopping flushes, and writes get encoded straight away again
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_set(buffer, 3000, expected, 
+        ECC_BUFFER_DATA_SIZE));
+    memcpy(expected + 3000, expected, ECC_BUFFER_DATA_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_write_back_stop(buffer));
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_write_back_stop(buffer));
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_set(buffer, 5000, expected, 10));
+    memcpy(expected + 5000, expected, 10);
+    ecc_buffer_stats(buffer, &stats);
+    TEST_ASSERT_EQUAL_UINT64(6, stats.chunks_flushed);
+    ecc_buffer_new_epoch(buffer);
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 0, result, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, result, BUFFER_SIZE);
+    ecc_buffer_stats(buffer, &stats);
+    TEST_ASSERT_EQUAL_UINT64(6, stats.chunks_flushed);
+    ecc_buffer_free(buffer);
+}
+
+void ecc_buffer_write_back_age_tests()
+{
+    uint32_t state = 7;
+    ecc_buffer_t* buffer = ecc_test_buffer(&state);
+    ecc_buffer_stats_t stats;
+    ecc_write_back_config_t config = { 20000, -1 };
+
+    // Too short to sleep between flushes
+    ecc_write_back_config_t too_short = { 3, -1 };
+    TEST_ASSERT_EQUAL_INT(-1, ecc_buffer_write_back_start(buffer, 
+        &too_short));
+
+    // Left alone, dirty chunks get flushed by the thread
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_write_back_start(buffer, &config));
+    for(int i = 0; i < BUFFER_SIZE; i++) {
+        expected[i] = (uint8_t)ecc_test_random(&state);
+    }
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_set(buffer, 0, expected, 
+        BUFFER_SIZE));
+    uint64_t chunks = (BUFFER_SIZE + ECC_BUFFER_DATA_SIZE - 1) / 
+        ECC_BUFFER_DATA_SIZE;
+    uint64_t deadline = ecc_test_now_us() + ECC_TEST_TIMEOUT_US;
+    do {
+        ecc_test_nap();
+        ecc_buffer_stats(buffer, &stats);
+    } while(stats.chunks_flushed < chunks && ecc_test_now_us() < deadline);
+    if(stats.chunks_flushed < chunks) {
+        ecc_buffer_free(buffer);
+        TEST_FAIL_MESSAGE("Dirty chunks didn't get flushed in time");
+    }
+    TEST_ASSERT_EQUAL_UINT64(chunks, stats.chunks_flushed);
+
+    uint8_t* data;
+    uint8_t* parity;
+    ecc_buffer_chunk(buffer, chunks - 1, &data, &parity);
+    data[1] ^= 0x3C;
+    ecc_buffer_new_epoch(buffer);
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 0, result, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, result, BUFFER_SIZE);
+
+    // Freeing stops the thread
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_set(buffer, 0, expected, 10));
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_free(buffer));
+}
+
+// Keeps writing what's already there over random spots until stopped
+typedef struct ecc_test_writer {
+    ecc_buffer_t* buffer;
+    uint32_t state;
+    int stop;
+    int failures;
+} ecc_test_writer_t;
+
+static void* ecc_test_writer_run(void* argument)
+{
+    ecc_test_writer_t* writer = (ecc_test_writer_t*)argument;
+    while(!__atomic_load_n(&writer->stop, __ATOMIC_ACQUIRE)) {
+        uint64_t offset = ecc_test_random(&writer->state) % 
+            (BUFFER_SIZE - 16);
+        if(ecc_buffer_set(writer->buffer, offset, expected + offset, 
+            16) != 0) {
+            writer->failures++;
+        }
+    }
+    return 0;
+}
+
+void ecc_buffer_write_back_stop_tests()
+{
+    uint32_t state = 9;
+    ecc_buffer_t* buffer = ecc_test_buffer(&state);
+    ecc_write_back_config_t config = { 0, -1 };
+    uint64_t chunks = (BUFFER_SIZE + ECC_BUFFER_DATA_SIZE - 1) / 
+        ECC_BUFFER_DATA_SIZE;
+
+    // Stopping write-back mode while other threads write leaves nothing
+    // dirty behind. A dirty chunk would take a flipped byte as data when
+    // read, where a clean one fixes it.
+    for(int round = 0; round < 50; round++) {
+        ecc_test_writer_t writers[4];
+        pthread_t threads[4];
+        TEST_ASSERT_EQUAL_INT(0, ecc_buffer_write_back_start(buffer, 
+            &config));
+        for(int i = 0; i < 4; i++) {
+            writers[i].buffer = buffer;
+            writers[i].state = (uint32_t)(round * 4 + i);
+            writers[i].stop = 0;
+            writers[i].failures = 0;
+            TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], 0, 
+                ecc_test_writer_run, &writers[i]));
+        }
+        int stopped = ecc_buffer_write_back_stop(buffer);
+        for(int i = 0; i < 4; i++) {
+            __atomic_store_n(&writers[i].stop, 1, __ATOMIC_RELEASE);
+            pthread_join(threads[i], 0);
+            TEST_ASSERT_EQUAL_INT(0, writers[i].failures);
+        }
+        TEST_ASSERT_EQUAL_INT(0, stopped);
+
+        for(uint64_t c = 0; c < chunks; c++) {
+            uint8_t* data;
+            uint8_t* parity;
+            ecc_buffer_chunk(buffer, c, &data, &parity);
+            data[round] ^= 0x42;
+        }
+        ecc_buffer_new_epoch(buffer);
+        TEST_ASSERT_EQUAL_INT(0, ecc_buffer_get(buffer, 0, result, 
+            BUFFER_SIZE));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, result, BUFFER_SIZE);
+    }
+    ecc_buffer_free(buffer);
+}
+
+void ecc_buffer_view_tests()
+{
+    uint32_t state = 8;
+    ecc_buffer_t* buffer = ecc_test_buffer(&state);
+    ecc_buffer_stats_t stats;
+
+    TEST_ASSERT_NULL(ecc_buffer_view(buffer, BUFFER_SIZE - 10, 11));
+    TEST_ASSERT_NULL(ecc_buffer_view(buffer, UINT64_MAX, 2));
+
+    // The data is one run, with every chunk's data right after the last
+    const data_t* view = ecc_buffer_view(buffer, 0, BUFFER_SIZE);
+    TEST_ASSERT_NOT_NULL(view);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, view, BUFFER_SIZE);
+    uint8_t* data;
+    uint8_t* parity;
+    for(int chunk = 0; chunk * ECC_BUFFER_DATA_SIZE < BUFFER_SIZE; chunk++) {
+        ecc_buffer_chunk(buffer, chunk, &data, &parity);
+        TEST_ASSERT_EQUAL_PTR(view + chunk * ECC_BUFFER_DATA_SIZE, data);
+    }
+    TEST_ASSERT_EQUAL_PTR(view + 1234, ecc_buffer_view(buffer, 1234, 500));
+
+    // Only the chunks in range get checked, and corrected in place
+    ecc_buffer_chunk(buffer, 6, &data, &parity);
+    data[17] ^= 0x99;
+    ecc_buffer_new_epoch(buffer);
+    ecc_buffer_stats(buffer, &stats);
+    uint64_t checked = stats.chunks_checked;
+    uint64_t start = 6 * ECC_BUFFER_DATA_SIZE - 10;
+    TEST_ASSERT_EQUAL_PTR(view + start, ecc_buffer_view(buffer, start, 20));
+    ecc_buffer_stats(buffer, &stats);
+    TEST_ASSERT_EQUAL_UINT64(checked + 2, stats.chunks_checked);
+    TEST_ASSERT_EQUAL_UINT64(1, stats.chunks_corrected);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, view, BUFFER_SIZE);
+
+    // Writes show up through the pointer
+    TEST_ASSERT_EQUAL_INT(0, ecc_buffer_set(buffer, 100, expected, 50));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, view + 100, 50);
+
+    // No pointer to data that couldn't be corrected
+    ecc_buffer_chunk(buffer, 9, &data, &parity);
+    for(int i = 0; i < ECC_BUFFER_DATA_SIZE; i += 2) {
+        data[i] ^= 0xA5;
+    }
+    ecc_buffer_new_epoch(buffer);
+    TEST_ASSERT_NULL(ecc_buffer_view(buffer, 0, BUFFER_SIZE));
+    TEST_ASSERT_NOT_NULL(ecc_buffer_view(buffer, 0, 9 * ECC_BUFFER_DATA_SIZE));
+    ecc_buffer_free(buffer);
+}
@@ -0,0 +1,16 @@
+#ifndef _ECC_BUFFERS_TESTS_H_
+#define _ECC_BUFFERS_TESTS_H_
+
+void ecc_buffer_init_tests();
+void ecc_buffer_round_trip_tests();
+void ecc_buffer_correct_tests();
+void ecc_buffer_lazy_verify_tests();
+void ecc_buffer_uncorrectable_tests();
+void ecc_buffer_scrub_tests();
+void ecc_buffer_scrubber_tests();
+void ecc_buffer_write_back_tests();
+void ecc_buffer_write_back_age_tests();
+void ecc_buffer_write_back_stop_tests();
+void ecc_buffer_view_tests();
+
+#endif
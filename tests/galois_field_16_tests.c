@@ -0,0 +1,178 @@
+#include "unity/unity.h"
+#include "galois_field_16_tests.h"
+#include "../galois_field_16.h"
+
+// The field is too big to sit on the stack, and only needs building once
+static gf16_field_t gf16_field;
+static const gf16_field_t* field = &gf16_field;
+
+static void gf16_tests_field_init()
+{
+    if(gf16_field.polynomial != GF16_POLYNOMIAL_DEFAULT) {
+        TEST_ASSERT_EQUAL_INT(0, 
+            gf16_field_init(&gf16_field, GF16_POLYNOMIAL_DEFAULT));
+    }
+}
+
+void gf16_field_init_tests()
+{
+    gf16_tests_field_init();
+    TEST_ASSERT_EQUAL_HEX32(GF16_POLYNOMIAL_DEFAULT, field->polynomial);
+    TEST_ASSERT_EQUAL_HEX16(0x0002, field->generator);
+
+    // Every non zero element shows up exactly once in the exp table
+    static uint8_t seen[GF16_LOG_TABLE_SIZE];
+    for(int i = 0; i < GF16_LOG_TABLE_SIZE; i++) {
+        seen[i] = 0;
+    }
+    for(int i = 0; i < GF16_ORDER; i++) {
+        TEST_ASSERT_EQUAL_HEX16(field->exp[i], field->exp[i + GF16_ORDER]);
+        TEST_ASSERT_EQUAL_INT(0, seen[field->exp[i]]);
+        seen[field->exp[i]] = 1;
+        TEST_ASSERT_EQUAL_INT(i, field->log[field->exp[i]]);
+    }
+    TEST_ASSERT_EQUAL_INT(0, seen[0]);
+
+    // Wrong degree
+    static gf16_field_t bad_field;
+    TEST_ASSERT_EQUAL_INT(-1, gf16_field_init(&bad_field, 0x100B));
+    TEST_ASSERT_EQUAL_INT(-1, gf16_field_init(&bad_field, 0x2100B));
+
+    // Reducible, x^16 + 1 = (x + 1)^16 and x^16 + x^8 = x^8 (x^8 + 1)
+    TEST_ASSERT_EQUAL_INT(-1, gf16_field_init(&bad_field, 0x10001));
+    TEST_ASSERT_EQUAL_INT(-1, gf16_field_init(&bad_field, 0x10100));
+    // (x^8 + x^4 + x^3 + x^2 + 1)^2
+    TEST_ASSERT_EQUAL_INT(-1, gf16_field_init(&bad_field, 0x10155));
+
+    // Another primitive polynomial works fine and gives a different field
+    // x^16 + x^5 + x^3 + x^2 + 1
+    TEST_ASSERT_EQUAL_INT(0, gf16_field_init(&bad_field, 0x1002D));
+    TEST_ASSERT_EQUAL_HEX16(0x002D, gf16_mul(&bad_field, 0x8000, 0x0002));
+    TEST_ASSERT_EQUAL_HEX16(0x100B, gf16_mul(field, 0x8000, 0x0002));
+}
+
+void gf16_mul_tests()
+{
+    gf16_tests_field_init();
+
+    // Small ones that won't trigger modulo
+    TEST_ASSERT_EQUAL_HEX16(0x000A, gf16_mul_nolut(field, 0x0002, 0x0005));
+    TEST_ASSERT_EQUAL_HEX16(0x5000, gf16_mul_nolut(field, 0x0100, 0x0050));
+
+    // Identities and zeroes
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, gf16_mul_nolut(field, 0xFFFF, 0x0001));
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, gf16_mul_nolut(field, 0x0001, 0xFFFF));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, gf16_mul_nolut(field, 0xFFFF, 0x0000));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, gf16_mul(field, 0x0000, 0xFFFF));
+
+    // Ones that trigger modulos
+    TEST_ASSERT_EQUAL_HEX16(0x100B, gf16_mul_nolut(field, 0x8000, 0x0002));
+    TEST_ASSERT_EQUAL_HEX16(0x2016, gf16_mul_nolut(field, 0x8000, 0x0004));
+    TEST_ASSERT_EQUAL_HEX16(0x100B, gf16_mul_nolut(field, 0x0002, 0x8000));
+}
+
+void gf16_mul_lut_tests()
+{
+    gf16_tests_field_init();
+
+    // Too big for exhaustive, so walk a good spread of pairs
+    for(uint32_t a = 0; a <= 0xFFFF; a += 251) {
+        for(uint32_t b = 0; b <= 0xFFFF; b += 257) {
+            TEST_ASSERT_EQUAL_HEX16(
+                gf16_mul_nolut(field, (uint16_t)a, (uint16_t)b), 
+                gf16_mul(field, (uint16_t)a, (uint16_t)b));
+        }
+    }
+}
+
+void gf16_muldiv_exhaustive_tests()
+{
+    gf16_tests_field_init();
+
+    // (a * b) / b = a for every a against a handful of b's
+    uint16_t divisors[] = { 0x0001, 0x0002, 0x1234, 0x8000, 0xFFFF };
+    for(int d = 0; d < 5; d++) {
+        for(uint32_t a = 0; a <= 0xFFFF; a++) {
+            uint16_t product = gf16_mul(field, (uint16_t)a, divisors[d]);
+            TEST_ASSERT_EQUAL_HEX16(a, gf16_div(field, product, divisors[d]));
+        }
+    }
+
+    // Dividing by 0 gives back 0
+    TEST_ASSERT_EQUAL_HEX16(0, gf16_div(field, 0x1234, 0));
+}
+
+void gf16_inv_tests()
+{
+    gf16_tests_field_init();
+
+    TEST_ASSERT_EQUAL_HEX16(0, gf16_inv(field, 0));
+    for(uint32_t a = 1; a <= 0xFFFF; a++) {
+        TEST_ASSERT_EQUAL_HEX16(1, 
+            gf16_mul(field, (uint16_t)a, gf16_inv(field, (uint16_t)a)));
+    }
+}
+
+void gf16_pow_tests()
+{
+    gf16_tests_field_init();
+
+    TEST_ASSERT_EQUAL_HEX16(1, gf16_pow(field, 0x1234, 0));
+    TEST_ASSERT_EQUAL_HEX16(1, gf16_pow(field, 0, 0));
+    TEST_ASSERT_EQUAL_HEX16(0, gf16_pow(field, 0, 5));
+    TEST_ASSERT_EQUAL_HEX16(0x8000, gf16_pow(field, 2, 15));
+    TEST_ASSERT_EQUAL_HEX16(0x100B, gf16_pow(field, 2, 16));
+
+    // Fermat, a^65535 = 1
+    TEST_ASSERT_EQUAL_HEX16(1, gf16_pow(field, 0xBEEF, GF16_ORDER));
+
+    // Compare against repeated multiplication
+    uint16_t x = 1;
+    for(uint32_t i = 0; i < 1000; i++) {
+        TEST_ASSERT_EQUAL_HEX16(x, gf16_pow(field, 0xBEEF, i));
+        x = gf16_mul(field, x, 0xBEEF);
+    }
+}
+
+void gf16_poly_tests()
+{
+    gf16_tests_field_init();
+
+    // (x + 2)(x + 3) = x^2 + x + 6
+    uint16_t p[] = { 1, 2 };
+    uint16_t q[] = { 1, 3 };
+    uint16_t buffer[3] = { 0xFFFF, 0xFFFF, 0xFFFF };
+    TEST_ASSERT_EQUAL_INT(0, gf16_poly_mul(field, buffer, p, q, 2, 2));
+    TEST_ASSERT_EQUAL_HEX16(1, buffer[0]);
+    TEST_ASSERT_EQUAL_HEX16(1, buffer[1]);
+    TEST_ASSERT_EQUAL_HEX16(6, buffer[2]);
+
+    // Roots are roots
+    TEST_ASSERT_EQUAL_HEX16(0, gf16_poly_eval(field, buffer, 2, 3));
+    TEST_ASSERT_EQUAL_HEX16(0, gf16_poly_eval(field, buffer, 3, 3));
+    TEST_ASSERT_EQUAL_HEX16(1 ^ 1 ^ 6, gf16_poly_eval(field, buffer, 1, 3));
+
+    TEST_ASSERT_EQUAL_INT(-1, gf16_poly_mul(field, buffer, p, q, 0, 2));
+}
+
+void gf16_region_mul_xor_tests()
+{
+    gf16_tests_field_init();
+
+    uint16_t src[300];
+    uint16_t dst[300];
+    uint16_t expected[300];
+    uint16_t constants[] = { 0x0000, 0x0001, 0x0002, 0xABCD, 0xFFFF };
+
+    for(int c = 0; c < 5; c++) {
+        for(int i = 0; i < 300; i++) {
+            // Sprinkle in some zeroes
+            src[i] = (i % 7 == 0) ? 0 : (uint16_t)(i * 40503u + 17);
+            dst[i] = (uint16_t)(i * 2654435761u);
+            expected[i] = dst[i] ^ gf16_mul_nolut(field, src[i], constants[c]);
+        }
+        TEST_ASSERT_EQUAL_INT(0, 
+            gf16_region_mul_xor(field, dst, src, constants[c], 300));
+        TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, dst, 300);
+    }
+}
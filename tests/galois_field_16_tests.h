@@ -0,0 +1,16 @@
+#ifndef _GALOIS_FIELD_16_TESTS_
+#define _GALOIS_FIELD_16_TESTS_
+
+void gf16_field_init_tests();
+
+void gf16_mul_tests();
+void gf16_mul_lut_tests();
+void gf16_muldiv_exhaustive_tests();
+
+void gf16_inv_tests();
+void gf16_pow_tests();
+
+void gf16_poly_tests();
+void gf16_region_mul_xor_tests();
+
+#endif
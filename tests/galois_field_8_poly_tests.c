@@ -2,6 +2,9 @@
 #include "galois_field_8_poly_tests.h"
 #include "../galois_field_8.h"
 
+// Everything here is in the usual 0x11D field
+static const gf8_field_t* field = &gf8_field_default;
+
 #define BUFFER_SIZE 0xFF
 
 void gf8_poly_scale_tests()
@@ -10,7 +13,7 @@ void gf8_poly_scale_tests()
     uint8_t buffer[BUFFER_SIZE] = {0};
     uint8_t p[4] = { 1, 2, 3, 4};
 
-    int result = gf8_poly_scale(buffer, p, 2, 4);
+    int result = gf8_poly_scale(field, buffer, p, 2, 4);
 
     TEST_ASSERT_EQUAL_INT8(0, result);
     TEST_ASSERT_EQUAL_HEX8(2, buffer[0]);
@@ -19,7 +22,7 @@ void gf8_poly_scale_tests()
     TEST_ASSERT_EQUAL_HEX8(8, buffer[3]);
 
     // Slightly more complicated example to test overflow
-    result = gf8_poly_scale(buffer, p, 255, 4);
+    result = gf8_poly_scale(field, buffer, p, 255, 4);
 
     TEST_ASSERT_EQUAL_INT8(0, result);
     TEST_ASSERT_EQUAL_HEX8(255, buffer[0]);
@@ -58,13 +61,13 @@ void gf8_poly_mul_tests()
     uint8_t p[2] = { 1, 101};
     uint8_t q[1] = { 42 };
 
-    int result = gf8_poly_mul(buffer, p, q, 2, 1);
+    int result = gf8_poly_mul(field, buffer, p, q, 2, 1);
     TEST_ASSERT_EQUAL_INT8(0, result);
     TEST_ASSERT_EQUAL_HEX8(42, buffer[0]);
     TEST_ASSERT_EQUAL_HEX8(249, buffer[1]);
 
     // Multiplication is communitive, swap p and q
-    result = gf8_poly_mul(buffer, q, p, 1, 2);
+    result = gf8_poly_mul(field, buffer, q, p, 1, 2);
     TEST_ASSERT_EQUAL_INT8(0, result);
     TEST_ASSERT_EQUAL_HEX8(42, buffer[0]);
     TEST_ASSERT_EQUAL_HEX8(249, buffer[1]);
@@ -80,7 +83,7 @@ void gf8_poly_mul_long_tests()
     uint8_t p[3] = { 55, 33, 200 };
     uint8_t q[2] = { 15, 243 };
 
-    int result = gf8_poly_mul(buffer, p, q, 3, 2);
+    int result = gf8_poly_mul(field, buffer, p, q, 3, 2);
     TEST_ASSERT_EQUAL_INT8(0, result);
     TEST_ASSERT_EQUAL_HEX8(32, buffer[0]);
     TEST_ASSERT_EQUAL_HEX8(145, buffer[1]);
@@ -97,7 +100,7 @@ void gf8_poly_div_tests_simple()
     uint8_t p[5] = { 1, 0, 1, 1, 1};
     uint8_t q[3] = { 1, 0, 1 };
 
-    int result = gf8_poly_div(buffer_quotient, buffer_remainder, 
+    int result = gf8_poly_div(field, buffer_quotient, buffer_remainder, 
         p, q, 5, 3);
 
     TEST_ASSERT_EQUAL_INT8(0, result);
@@ -110,6 +113,20 @@ void gf8_poly_div_tests_simple()
     TEST_ASSERT_EQUAL_HEX8(0, buffer_remainder[0]);
     TEST_ASSERT_EQUAL_HEX8(1, buffer_remainder[1]);
     TEST_ASSERT_EQUAL_HEX8(1, buffer_remainder[2]);
+
+    // Same length works too, the quotient is just a constant
+    uint8_t p2[3] = { 1, 1, 0 };
+    result = gf8_poly_div(field, buffer_quotient, buffer_remainder, 
+        p2, q, 3, 3);
+
+    TEST_ASSERT_EQUAL_INT8(0, result);
+    TEST_ASSERT_EQUAL_HEX8(0, buffer_quotient[0]);
+    TEST_ASSERT_EQUAL_HEX8(0, buffer_quotient[1]);
+    TEST_ASSERT_EQUAL_HEX8(1, buffer_quotient[2]);
+
+    TEST_ASSERT_EQUAL_HEX8(0, buffer_remainder[0]);
+    TEST_ASSERT_EQUAL_HEX8(1, buffer_remainder[1]);
+    TEST_ASSERT_EQUAL_HEX8(1, buffer_remainder[2]);
 }
 
 void gf8_poly_div_tests()
@@ -122,7 +139,7 @@ void gf8_poly_div_tests()
     uint8_t p[4] = { 32, 145, 180, 241 };
     uint8_t q[2] = { 15, 243 };
 
-    int result = gf8_poly_div(buffer_quotient, buffer_remainder, 
+    int result = gf8_poly_div(field, buffer_quotient, buffer_remainder, 
         p, q, 4, 2);
 
     TEST_ASSERT_EQUAL_INT8(0, result);
@@ -143,7 +160,7 @@ void gf8_poly_div_tests2()
     uint8_t p[7] = { 0x12, 0x34, 0x56, 0x00, 0x00, 0x00, 0x00 };
     uint8_t q[5] = { 0x01, 0x0F, 0x36, 0x78, 0x40 };
 
-    int result = gf8_poly_div(buffer_quotient, buffer_remainder, 
+    int result = gf8_poly_div(field, buffer_quotient, buffer_remainder, 
         p, q, 7, 5);
 
     TEST_ASSERT_EQUAL_INT8(0, result);
@@ -162,17 +179,17 @@ void gf8_poly_eval_tests()
     // Trivial example
     // Evaluate x^2 + x^1 + x^0 where x = 2.
     uint8_t p[3] = { 1, 1, 1 };
-    int result = gf8_poly_eval(p, 2, 3);
+    int result = gf8_poly_eval(field, p, 2, 3);
     TEST_ASSERT_EQUAL_INT8(7, result);
 
     // Evaluate x^2 + 2*x^1 + 2*x^0 where x = 2.
     uint8_t p2[3] = { 1, 2, 3 };
-    result = gf8_poly_eval(p2, 2, 3);
+    result = gf8_poly_eval(field, p2, 2, 3);
     TEST_ASSERT_EQUAL_INT8(3, result);
 
     // Slightly more complicated polynomial
     // Evaluate 2*x^3 + 3*x^2 + 0*x^2 + 4*1 where x = 243
     uint8_t p3[4] = { 2, 3, 0, 4 };
-    result = gf8_poly_eval(p3, 243, 4);
+    result = gf8_poly_eval(field, p3, 243, 4);
     TEST_ASSERT_EQUAL_INT8(97, result);
 }
\ No newline at end of file
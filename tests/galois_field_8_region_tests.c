@@ -0,0 +1,274 @@
+#include "unity/unity.h"
+#include "galois_field_8_region_tests.h"
+#include "../galois_field_8.h"
+
+// Field the tests run in. Usually the 0x11D one, 
+// gf8_region_other_field_tests swaps it out.
+static const gf8_field_t* field = &gf8_field_default;
+
+// Big enough to cover the AVX2, SSSE3 and scalar tails at once
+#define BUFFER_SIZE 300
+
+// Fills the buffer with something that isn't too regular
+static void fill_pattern(uint8_t* buffer, int length, uint8_t seed)
+{
+    for(int i = 0; i < length; i++) {
+        buffer[i] = (uint8_t)(i * 37 + seed * 11 + (i >> 3));
+    }
+}
+
+// Runs a test once per region kernel implementation the CPU supports,
+// then puts the default one back.
+static void for_each_impl(void (*test)())
+{
+    gf8_impl_t original = gf8_region_impl();
+    for(int impl = 0; impl < GF8_IMPL_COUNT; impl++) {
+        if(gf8_region_set_impl((gf8_impl_t)impl) == 0) {
+            test();
+        }
+    }
+    gf8_region_set_impl(original);
+}
+
+static void region_mul_test()
+{
+    uint8_t src[BUFFER_SIZE];
+    uint8_t dst[BUFFER_SIZE];
+    fill_pattern(src, BUFFER_SIZE, 1);
+
+    // Every constant, against the scalar multiply
+    for(int c = 0; c <= 0xFF; c++) {
+        int result = gf8_region_mul(field, dst, src, c, BUFFER_SIZE);
+        TEST_ASSERT_EQUAL_INT8(0, result);
+        for(int i = 0; i < BUFFER_SIZE; i++) {
+            TEST_ASSERT_EQUAL_HEX8(gf8_mul(field, src[i], c), dst[i]);
+        }
+    }
+
+    // Odd lengths and unaligned starts shouldn't matter, and
+    // we shouldn't write past the end.
+    for(int length = 0; length < 140; length++) {
+        for(int i = 0; i < BUFFER_SIZE; i++) {
+            dst[i] = 0xA5;
+        }
+        gf8_region_mul(field, dst + 3, src + 1, 0x8E, length);
+        TEST_ASSERT_EQUAL_HEX8(0xA5, dst[2]);
+        for(int i = 0; i < length; i++) {
+            TEST_ASSERT_EQUAL_HEX8(gf8_mul(field, src[i + 1], 0x8E), dst[i + 3]);
+        }
+        TEST_ASSERT_EQUAL_HEX8(0xA5, dst[length + 3]);
+    }
+}
+
+static void region_mul_xor_test()
+{
+    uint8_t src[BUFFER_SIZE];
+    uint8_t acc[BUFFER_SIZE];
+    uint8_t dst[BUFFER_SIZE];
+    fill_pattern(src, BUFFER_SIZE, 2);
+    fill_pattern(acc, BUFFER_SIZE, 3);
+
+    for(int c = 0; c <= 0xFF; c++) {
+        for(int i = 0; i < BUFFER_SIZE; i++) {
+            dst[i] = acc[i];
+        }
+        int result = gf8_region_mul_xor(field, dst, src, c, BUFFER_SIZE);
+        TEST_ASSERT_EQUAL_INT8(0, result);
+        for(int i = 0; i < BUFFER_SIZE; i++) {
+            TEST_ASSERT_EQUAL_HEX8(acc[i] ^ gf8_mul(field, src[i], c), dst[i]);
+        }
+    }
+
+    // Short and odd lengths, with nothing written past the end
+    for(int length = 0; length < 140; length++) {
+        for(int i = 0; i < BUFFER_SIZE; i++) {
+            dst[i] = acc[i];
+        }
+        gf8_region_mul_xor(field, dst, src + 5, 0xC3, length);
+        for(int i = 0; i < length; i++) {
+            TEST_ASSERT_EQUAL_HEX8(acc[i] ^ gf8_mul(field, src[i + 5], 0xC3), dst[i]);
+        }
+        TEST_ASSERT_EQUAL_HEX8(acc[length], dst[length]);
+    }
+}
+
+static void region_mul_inplace_test()
+{
+    uint8_t buffer[BUFFER_SIZE];
+    uint8_t expected[BUFFER_SIZE];
+    fill_pattern(buffer, BUFFER_SIZE, 4);
+
+    for(int i = 0; i < BUFFER_SIZE; i++) {
+        expected[i] = gf8_mul(field, buffer[i], 0x53);
+    }
+
+    // Source and destination can be the same region
+    int result = gf8_region_mul(field, buffer, buffer, 0x53, BUFFER_SIZE);
+    TEST_ASSERT_EQUAL_INT8(0, result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, buffer, BUFFER_SIZE);
+
+    // And multiplying by the inverse gets us back where we started
+    fill_pattern(expected, BUFFER_SIZE, 4);
+    gf8_region_mul(field, buffer, buffer, gf8_inv(field, 0x53), BUFFER_SIZE);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, buffer, BUFFER_SIZE);
+}
+
+static void region_dot_test()
+{
+    // 40 rows of up to 100 columns, padded out to a stride of 104
+    static uint8_t matrix[40 * 104];
+    uint8_t coefficients[40];
+    uint8_t dst[BUFFER_SIZE];
+    uint8_t expected[BUFFER_SIZE];
+    fill_pattern(matrix, sizeof(matrix), 6);
+    fill_pattern(coefficients, 40, 7);
+    coefficients[3] = 0;
+    coefficients[5] = 1;
+
+    // Lengths that hit every kernel's tail
+    int lengths[] = { 0, 1, 16, 31, 64, 79, 100 };
+    for(int l = 0; l < (int)(sizeof(lengths) / sizeof(lengths[0])); l++) {
+        int len = lengths[l];
+        for(int j = 0; j < BUFFER_SIZE; j++) {
+            dst[j] = 0xAA;
+            expected[j] = 0xAA;
+        }
+        for(int j = 0; j < len; j++) {
+            expected[j] = 0;
+            for(int i = 0; i < 40; i++) {
+                expected[j] ^= gf8_mul(field, coefficients[i], 
+                    matrix[i * 104 + j]);
+            }
+        }
+
+        int result = gf8_region_dot(field, dst, matrix, 104, 
+            coefficients, 40, len);
+        TEST_ASSERT_EQUAL_INT8(0, result);
+
+        // Nothing past len gets touched
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, dst, BUFFER_SIZE);
+    }
+
+    // No rows at all is all zeroes
+    gf8_region_dot(field, dst, matrix, 104, coefficients, 0, 20);
+    for(int j = 0; j < 20; j++) {
+        TEST_ASSERT_EQUAL_HEX8(0, dst[j]);
+    }
+}
+
+static void region_syndromes_test()
+{
+    uint8_t data[BUFFER_SIZE];
+    uint8_t syndromes[BUFFER_SIZE];
+    fill_pattern(data, BUFFER_SIZE, 5);
+
+    // Compare against evaluating at each power of the generator
+    // on its own.
+    // 100 roots makes the GFNI kernel go around twice.
+    int lengths[] = { 0, 1, 19, 255 };
+    for(int l = 0; l < (int)(sizeof(lengths) / sizeof(lengths[0])); l++) {
+        int result = gf8_region_syndromes(field, syndromes, data, lengths[l], 100);
+        TEST_ASSERT_EQUAL_INT8(0, result);
+        for(int i = 0; i < 100; i++) {
+            uint8_t expected = 0;
+            if(lengths[l] > 0) {
+                expected = gf8_poly_eval(field, data, 
+                    gf8_pow(field, field->generator, i), lengths[l]);
+            }
+            TEST_ASSERT_EQUAL_HEX8(expected, syndromes[i]);
+        }
+    }
+}
+
+static void region_eval_test()
+{
+    uint8_t data[BUFFER_SIZE];
+    uint8_t points[BUFFER_SIZE];
+    uint8_t values[BUFFER_SIZE];
+    fill_pattern(data, BUFFER_SIZE, 7);
+
+    // Every point including 0, in a jumbled order
+    for(int i = 0; i < 256; i++) {
+        points[i] = (uint8_t)(i * 167 + 3);
+    }
+    int lengths[] = { 0, 1, 33, 255 };
+    for(int l = 0; l < (int)(sizeof(lengths) / sizeof(lengths[0])); l++) {
+        int result = gf8_region_eval(field, values, data, lengths[l], 
+            points, 256);
+        TEST_ASSERT_EQUAL_INT8(0, result);
+        for(int i = 0; i < 256; i++) {
+            uint8_t expected = 0;
+            if(lengths[l] > 0) {
+                expected = gf8_poly_eval(field, data, points[i], lengths[l]);
+            }
+            TEST_ASSERT_EQUAL_HEX8(expected, values[i]);
+        }
+    }
+}
+
+void gf8_region_mul_tests()
+{
+    for_each_impl(region_mul_test);
+}
+
+void gf8_region_mul_xor_tests()
+{
+    for_each_impl(region_mul_xor_test);
+}
+
+void gf8_region_mul_inplace_tests()
+{
+    for_each_impl(region_mul_inplace_test);
+}
+
+void gf8_region_dot_tests()
+{
+    for_each_impl(region_dot_test);
+}
+
+void gf8_region_syndromes_tests()
+{
+    for_each_impl(region_syndromes_test);
+}
+
+void gf8_region_eval_tests()
+{
+    for_each_impl(region_eval_test);
+}
+
+void gf8_region_dispatch_tests()
+{
+    // Scalar always works, and startup should have picked 
+    // the best supported implementation.
+    TEST_ASSERT_EQUAL_INT(1, gf8_region_impl_supported(GF8_IMPL_SCALAR));
+    TEST_ASSERT_EQUAL_INT(1, gf8_region_impl_supported(gf8_region_impl()));
+    for(int impl = gf8_region_impl() + 1; impl < GF8_IMPL_COUNT; impl++) {
+        TEST_ASSERT_EQUAL_INT(0, gf8_region_impl_supported((gf8_impl_t)impl));
+    }
+
+    TEST_ASSERT_EQUAL_STRING("scalar", gf8_region_impl_name(GF8_IMPL_SCALAR));
+    TEST_ASSERT_EQUAL_STRING("gfni", gf8_region_impl_name(GF8_IMPL_GFNI));
+
+    // Bogus implementations can't be selected
+    gf8_impl_t original = gf8_region_impl();
+    TEST_ASSERT_EQUAL_INT(-1, gf8_region_set_impl(GF8_IMPL_COUNT));
+    TEST_ASSERT_EQUAL_INT(original, gf8_region_impl());
+}
+
+void gf8_region_other_field_tests()
+{
+    // The kernels shouldn't care about the polynomial
+    static gf8_field_t other_field;
+    uint16_t polynomials[] = { GF8_POLYNOMIAL_CCSDS, GF8_POLYNOMIAL_AES };
+
+    for(int i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL_INT(0, gf8_field_init(&other_field, polynomials[i]));
+        field = &other_field;
+        for_each_impl(region_mul_test);
+        for_each_impl(region_mul_xor_test);
+        for_each_impl(region_dot_test);
+        for_each_impl(region_syndromes_test);
+        for_each_impl(region_eval_test);
+    }
+    field = &gf8_field_default;
+}
@@ -0,0 +1,13 @@
+#ifndef _GALOIS_FIELD_8_REGION_TESTS_
+#define _GALOIS_FIELD_8_REGION_TESTS_
+
+void gf8_region_mul_tests();
+void gf8_region_mul_xor_tests();
+void gf8_region_mul_inplace_tests();
+void gf8_region_dot_tests();
+void gf8_region_syndromes_tests();
+void gf8_region_eval_tests();
+void gf8_region_dispatch_tests();
+void gf8_region_other_field_tests();
+
+#endif
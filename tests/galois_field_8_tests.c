@@ -2,6 +2,9 @@
 #include "galois_field_8_tests.h"
 #include "../galois_field_8.h"
 
+// Everything here is in the usual 0x11D field
+static const gf8_field_t* field = &gf8_field_default;
+
 void setUp(void) {
     // set stuff up here
 }
@@ -34,22 +37,22 @@ void gf8_mul_tests() {
     // lut table integrity later.
 
     // Small ones that won't trigger modulo
-    TEST_ASSERT_EQUAL_HEX8(0x0A, gf8_mul_nolut(0x02, 0x05));
+    TEST_ASSERT_EQUAL_HEX8(0x0A, gf8_mul_nolut(field, 0x02, 0x05));
 
     // Identities
-    TEST_ASSERT_EQUAL_HEX8(0xFF, gf8_mul_nolut(0xFF, 0x01));
-    TEST_ASSERT_EQUAL_HEX8(0xFF, gf8_mul_nolut(0x01, 0xFF));
+    TEST_ASSERT_EQUAL_HEX8(0xFF, gf8_mul_nolut(field, 0xFF, 0x01));
+    TEST_ASSERT_EQUAL_HEX8(0xFF, gf8_mul_nolut(field, 0x01, 0xFF));
 
     // Mins, maxes, and zeroes
-    TEST_ASSERT_EQUAL_HEX8(0xE2, gf8_mul_nolut(0xFF, 0xFF));
-    TEST_ASSERT_EQUAL_HEX8(0x00, gf8_mul_nolut(0xFF, 0x00));
-    TEST_ASSERT_EQUAL_HEX8(0x00, gf8_mul_nolut(0x00, 0xFF));
-    TEST_ASSERT_EQUAL_HEX8(0x00, gf8_mul_nolut(0x00, 0x00));
+    TEST_ASSERT_EQUAL_HEX8(0xE2, gf8_mul_nolut(field, 0xFF, 0xFF));
+    TEST_ASSERT_EQUAL_HEX8(0x00, gf8_mul_nolut(field, 0xFF, 0x00));
+    TEST_ASSERT_EQUAL_HEX8(0x00, gf8_mul_nolut(field, 0x00, 0xFF));
+    TEST_ASSERT_EQUAL_HEX8(0x00, gf8_mul_nolut(field, 0x00, 0x00));
 
     // Ones that trigger modulos
-    TEST_ASSERT_EQUAL_HEX8(0x39, gf8_mul_nolut(0x40, 0x52));
-    TEST_ASSERT_EQUAL_HEX8(0x39, gf8_mul_nolut(0x52, 0x40));
-    TEST_ASSERT_EQUAL_HEX8(0xB7, gf8_mul_nolut(0xF0, 0xF0));
+    TEST_ASSERT_EQUAL_HEX8(0x39, gf8_mul_nolut(field, 0x40, 0x52));
+    TEST_ASSERT_EQUAL_HEX8(0x39, gf8_mul_nolut(field, 0x52, 0x40));
+    TEST_ASSERT_EQUAL_HEX8(0xB7, gf8_mul_nolut(field, 0xF0, 0xF0));
 }
 
 void gf8_mul_lut_tests() {
@@ -61,8 +64,8 @@ void gf8_mul_lut_tests() {
         for(uint8_t b = 0; b < 0xFF; b++)
         {
             // Compare lut against nolut
-            uint8_t val_a = gf8_mul_nolut(a, b);
-            uint8_t val_b = gf8_mul(a, b);
+            uint8_t val_a = gf8_mul_nolut(field, a, b);
+            uint8_t val_b = gf8_mul(field, a, b);
             TEST_ASSERT_EQUAL_HEX8(val_a, val_b);
         }
     }
@@ -71,19 +74,19 @@ void gf8_mul_lut_tests() {
 void gf8_div_tests() { 
 
     // Identities
-    TEST_ASSERT_EQUAL_HEX8(0xFF, gf8_div(0xFF, 0x01));
-    TEST_ASSERT_EQUAL_HEX8(0xFD, gf8_div(0x01, 0xFF));
+    TEST_ASSERT_EQUAL_HEX8(0xFF, gf8_div(field, 0xFF, 0x01));
+    TEST_ASSERT_EQUAL_HEX8(0xFD, gf8_div(field, 0x01, 0xFF));
 
     // Zeroes
-    TEST_ASSERT_EQUAL_HEX8(0x00, gf8_div(0xFF, 0x00));
-    TEST_ASSERT_EQUAL_HEX8(0x00, gf8_div(0x00, 0xFF));
-    TEST_ASSERT_EQUAL_HEX8(0x00, gf8_div(0x00, 0x00));
+    TEST_ASSERT_EQUAL_HEX8(0x00, gf8_div(field, 0xFF, 0x00));
+    TEST_ASSERT_EQUAL_HEX8(0x00, gf8_div(field, 0x00, 0xFF));
+    TEST_ASSERT_EQUAL_HEX8(0x00, gf8_div(field, 0x00, 0x00));
 
     // Division as opposite of ones on top
-    TEST_ASSERT_EQUAL_HEX8(0xFF, gf8_div(0xE2, 0xFF));
-    TEST_ASSERT_EQUAL_HEX8(0x40, gf8_div(0x39, 0x52));
-    TEST_ASSERT_EQUAL_HEX8(0x52, gf8_div(0x39, 0x40));
-    TEST_ASSERT_EQUAL_HEX8(0xF0, gf8_div(0xB7, 0xF0));
+    TEST_ASSERT_EQUAL_HEX8(0xFF, gf8_div(field, 0xE2, 0xFF));
+    TEST_ASSERT_EQUAL_HEX8(0x40, gf8_div(field, 0x39, 0x52));
+    TEST_ASSERT_EQUAL_HEX8(0x52, gf8_div(field, 0x39, 0x40));
+    TEST_ASSERT_EQUAL_HEX8(0xF0, gf8_div(field, 0xB7, 0xF0));
 
 }
 
@@ -101,8 +104,8 @@ void gf8_muldiv_exhaustive_tests() {
             // to show that   
             //              a = a
             // in fact does hold.
-            uint8_t r = gf8_mul(a, b);
-            uint8_t a_new = gf8_div(r, b);
+            uint8_t r = gf8_mul(field, a, b);
+            uint8_t a_new = gf8_div(field, r, b);
 
             // Dividing by zero is undefined.. but we expect zero,
             // not the original a
@@ -119,19 +122,19 @@ void gf8_muldiv_exhaustive_tests() {
 void gf8_inv_tests() {
 
     // Test inverse of 0
-    uint8_t zero_case = gf8_inv(0);
+    uint8_t zero_case = gf8_inv(field, 0);
     TEST_ASSERT_EQUAL_HEX8(0, zero_case);
 
     // Test other cases
     for(uint8_t i = 1; i < 0xFF; i++) {
 
         // Make sure inverse gives us the correct result
-        uint8_t x_inv = gf8_inv(i);
-        uint8_t x = gf8_div(1, i);
+        uint8_t x_inv = gf8_inv(field, i);
+        uint8_t x = gf8_div(field, 1, i);
         TEST_ASSERT_EQUAL_HEX8(x, x_inv);
 
         // Make sure we get that x * x^-1 = 1
-        uint8_t one = gf8_mul(x_inv, i);
+        uint8_t one = gf8_mul(field, x_inv, i);
         TEST_ASSERT_EQUAL_HEX8(1, one);
     }
 }
@@ -141,16 +144,77 @@ void gf8_pow_tests() {
     // Alright, do ones that we know are easily verifable
     // like 2^0 .. 2^7
     for(int i = 0; i < 8; i++) {
-        TEST_ASSERT_EQUAL_HEX8(1 << i, gf8_pow(2, i));
+        TEST_ASSERT_EQUAL_HEX8(1 << i, gf8_pow(field, 2, i));
     }
     
     // Do some small hand written ones
-    TEST_ASSERT_EQUAL_HEX8(1, gf8_pow(3, 0));
-    TEST_ASSERT_EQUAL_HEX8(5, gf8_pow(3, 2));
-    TEST_ASSERT_EQUAL_HEX8(17, gf8_pow(3, 4));
+    TEST_ASSERT_EQUAL_HEX8(1, gf8_pow(field, 3, 0));
+    TEST_ASSERT_EQUAL_HEX8(5, gf8_pow(field, 3, 2));
+    TEST_ASSERT_EQUAL_HEX8(17, gf8_pow(field, 3, 4));
 
     // Do some large hand written ones
-    TEST_ASSERT_EQUAL_HEX8(226, gf8_pow(255, 2));
-    TEST_ASSERT_EQUAL_HEX8(38, gf8_pow(255, 3));
-    TEST_ASSERT_EQUAL_HEX8(174, gf8_pow(255, 4));
-}
\ No newline at end of file
+    TEST_ASSERT_EQUAL_HEX8(226, gf8_pow(field, 255, 2));
+    TEST_ASSERT_EQUAL_HEX8(38, gf8_pow(field, 255, 3));
+    TEST_ASSERT_EQUAL_HEX8(174, gf8_pow(field, 255, 4));
+}
+
+void gf8_tables_tests() {
+    // The generated tables have to agree with the peasant multiply.
+    // exp is doubled, so both halves should be the powers of 2.
+    uint8_t x = 1;
+    for(int i = 0; i < 0xFF; i++) {
+        TEST_ASSERT_EQUAL_HEX8(x, field->exp[i]);
+        TEST_ASSERT_EQUAL_HEX8(x, field->exp[i + 0xFF]);
+        TEST_ASSERT_EQUAL_HEX8(i, field->log[x]);
+        x = gf8_mul_nolut(field, x, 2);
+    }
+
+    // Nibble product tables
+    for(int c = 0; c <= 0xFF; c++) {
+        for(int i = 0; i < 16; i++) {
+            TEST_ASSERT_EQUAL_HEX8(gf8_mul_nolut(field, c, i), field->mul_lo[c][i]);
+            TEST_ASSERT_EQUAL_HEX8(gf8_mul_nolut(field, c, i << 4), field->mul_hi[c][i]);
+        }
+    }
+}
+
+void gf8_field_init_tests() {
+    static gf8_field_t test_field;
+
+    // Building the default polynomial at runtime should give exactly
+    // the generated tables
+    TEST_ASSERT_EQUAL_INT(0, 
+        gf8_field_init(&test_field, GF8_POLYNOMIAL_DEFAULT));
+    TEST_ASSERT_EQUAL_MEMORY(&gf8_field_default, &test_field, 
+        sizeof(gf8_field_t));
+
+    // CCSDS, 2 is a generator
+    TEST_ASSERT_EQUAL_INT(0, gf8_field_init(&test_field, GF8_POLYNOMIAL_CCSDS));
+    TEST_ASSERT_EQUAL_HEX8(0x02, test_field.generator);
+    TEST_ASSERT_EQUAL_HEX8(0x87, gf8_mul(&test_field, 0x80, 0x02));
+
+    // AES, 2 isn't a generator but 3 is. 
+    // 0x53 and 0xCA are inverses (FIPS-197).
+    TEST_ASSERT_EQUAL_INT(0, gf8_field_init(&test_field, GF8_POLYNOMIAL_AES));
+    TEST_ASSERT_EQUAL_HEX8(0x03, test_field.generator);
+    TEST_ASSERT_EQUAL_HEX8(0x01, gf8_mul(&test_field, 0x53, 0xCA));
+    TEST_ASSERT_EQUAL_HEX8(0xCA, gf8_inv(&test_field, 0x53));
+    TEST_ASSERT_EQUAL_HEX8(0xC1, gf8_mul(&test_field, 0x57, 0x83));
+
+    // Lookups agree with the peasant multiply, and division undoes it
+    for(int a = 0; a <= 0xFF; a++) {
+        for(int b = 0; b <= 0xFF; b++) {
+            uint8_t r = gf8_mul(&test_field, a, b);
+            TEST_ASSERT_EQUAL_HEX8(gf8_mul_nolut(&test_field, a, b), r);
+            if(b != 0) {
+                TEST_ASSERT_EQUAL_HEX8(a, gf8_div(&test_field, r, b));
+            }
+        }
+    }
+
+    // Not degree 8, or reducible
+    TEST_ASSERT_EQUAL_INT(-1, gf8_field_init(&test_field, 0x1D));
+    TEST_ASSERT_EQUAL_INT(-1, gf8_field_init(&test_field, 0x21D));
+    TEST_ASSERT_EQUAL_INT(-1, gf8_field_init(&test_field, 0x100));
+    TEST_ASSERT_EQUAL_INT(-1, gf8_field_init(&test_field, 0x1FF));
+}
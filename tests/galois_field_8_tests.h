@@ -13,4 +13,7 @@ void gf8_muldiv_exhaustive_tests();
 void gf8_inv_tests();
 void gf8_pow_tests();
 
+void gf8_tables_tests();
+void gf8_field_init_tests();
+
 #endif
\ No newline at end of file
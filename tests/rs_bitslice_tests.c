@@ -0,0 +1,400 @@
+#include "unity/unity.h"
+#include "rs_bitslice_tests.h"
+#include "../rs_bitslice.h"
+#include "../rs_ec.h"
+
+// Everything here is in the usual 0x11D field unless noted
+static const gf8_field_t* field = &gf8_field_default;
+
+// A couple of batches worth, with the last one partial
+#define CODEWORD_COUNT 150
+#define STRIDE 256
+#define BUFFER_SIZE 512
+
+static uint8_t codewords[CODEWORD_COUNT * STRIDE];
+static uint8_t expected[CODEWORD_COUNT * STRIDE];
+static uint64_t planes[RS_BITSLICE_PLANES(RS_BITSLICE_MAX_CODEWORD + 1)];
+static rs_bitslice_encoder_t encoder;
+
+static void fill_messages(int message_length)
+{
+    for(int l = 0; l < CODEWORD_COUNT; l++) {
+        for(int i = 0; i < STRIDE; i++) {
+            codewords[l * STRIDE + i] = (i < message_length) ? 
+                (uint8_t)((l * 131 + i * 29) ^ (l >> 2)) : 0;
+        }
+    }
+}
+
+// Encodes every codeword in the byte layout with rs_encode
+static void encode_expected(const gf8_field_t* f, 
+    const uint8_t* generator, int message_length, int generator_length)
+{
+    uint8_t buffer[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    uint8_t message_buffer[BUFFER_SIZE] = {0};
+    int codeword_length = message_length + generator_length - 1;
+
+    for(int l = 0; l < CODEWORD_COUNT; l++) {
+        for(int i = 0; i < message_length; i++) {
+            message_buffer[i] = codewords[l * STRIDE + i];
+        }
+        TEST_ASSERT_EQUAL_INT(0, rs_encode(f, buffer, working_buffer, 
+            message_buffer, message_length, (uint8_t*)generator, 
+            generator_length));
+        for(int i = 0; i < codeword_length; i++) {
+            expected[l * STRIDE + i] = buffer[i];
+        }
+    }
+}
+
+void rs_bitslice_transpose_tests()
+{
+    uint8_t out[RS_BITSLICE_LANES * 40];
+    fill_messages(40);
+
+    // Round trip with full and partial batches
+    int lanes_to_try[] = { 64, 1, 7, 9, 63 };
+    for(int t = 0; t < 5; t++) {
+        int lanes = lanes_to_try[t];
+        for(int i = 0; i < (int)sizeof(out); i++) {
+            out[i] = 0xAA;
+        }
+        rs_bitslice_transpose_in(planes, codewords, STRIDE, 40, lanes);
+        rs_bitslice_transpose_out(out, planes, 40, 40, lanes);
+        for(int l = 0; l < lanes; l++) {
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(codewords + l * STRIDE, 
+                out + l * 40, 40);
+        }
+    }
+
+    // Bit L of plane b of symbol j is bit b of codeword L's symbol j
+    rs_bitslice_transpose_in(planes, codewords, STRIDE, 40, 64);
+    for(int j = 0; j < 40; j += 13) {
+        for(int b = 0; b < 8; b++) {
+            for(int l = 0; l < 64; l++) {
+                int bit = (codewords[l * STRIDE + j] >> b) & 1;
+                TEST_ASSERT_EQUAL_INT(bit, 
+                    (int)((planes[j * 8 + b] >> l) & 1));
+            }
+        }
+    }
+
+    // Missing lanes are zero
+    rs_bitslice_transpose_in(planes, codewords, STRIDE, 40, 5);
+    for(int i = 0; i < RS_BITSLICE_PLANES(40); i++) {
+        TEST_ASSERT_EQUAL_HEX64(0, planes[i] & ~0x1FULL);
+    }
+}
+
+void rs_bitslice_encode_tests()
+{
+    uint8_t generator[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+
+    // (255, 223) and a short code
+    int message_lengths[] = { 223, 16 };
+    int generator_lengths[] = { 33, 11 };
+    for(int t = 0; t < 2; t++) {
+        int message_length = message_lengths[t];
+        int generator_length = generator_lengths[t];
+        int codeword_length = message_length + generator_length - 1;
+
+        rs_generator_polynomial(field, generator, working_buffer, 
+            generator_length);
+        TEST_ASSERT_EQUAL_INT(0, rs_bitslice_init(field, &encoder, 
+            generator, generator_length));
+
+        fill_messages(message_length);
+        encode_expected(field, generator, message_length, generator_length);
+
+        int result = rs_bitslice_encode_batch(&encoder, codewords, STRIDE, 
+            message_length, CODEWORD_COUNT, planes);
+        TEST_ASSERT_EQUAL_INT(0, result);
+        for(int l = 0; l < CODEWORD_COUNT; l++) {
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(expected + l * STRIDE, 
+                codewords + l * STRIDE, codeword_length);
+        }
+    }
+
+    // Too long and too short
+    TEST_ASSERT_EQUAL_INT(-1, rs_bitslice_encode(&encoder, planes, 246));
+    TEST_ASSERT_EQUAL_INT(-1, rs_bitslice_encode(&encoder, planes, 0));
+    TEST_ASSERT_EQUAL_INT(-1, rs_bitslice_init(field, &encoder, 
+        generator, 1));
+}
+
+void rs_bitslice_calc_syndromes_tests()
+{
+    uint8_t generator[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    static uint8_t syndromes[CODEWORD_COUNT * 33];
+    uint8_t expected_syndromes[BUFFER_SIZE];
+
+    int message_length = 223;
+    int generator_length = 33;
+    int codeword_length = 255;
+    rs_generator_polynomial(field, generator, working_buffer, 
+        generator_length);
+    rs_bitslice_init(field, &encoder, generator, generator_length);
+
+    fill_messages(message_length);
+    rs_bitslice_encode_batch(&encoder, codewords, STRIDE, 
+        message_length, CODEWORD_COUNT, planes);
+
+    // Corrupt some of the codewords
+    for(int l = 0; l < CODEWORD_COUNT; l += 3) {
+        codewords[l * STRIDE + (l % codeword_length)] ^= (uint8_t)(l | 1);
+    }
+
+    int result = rs_bitslice_calc_syndromes_batch(&encoder, syndromes, 
+        codewords, STRIDE, codeword_length, CODEWORD_COUNT, planes);
+    TEST_ASSERT_EQUAL_INT(0, result);
+
+    for(int l = 0; l < CODEWORD_COUNT; l++) {
+        rs_calc_syndromes(field, expected_syndromes, 
+            codewords + l * STRIDE, codeword_length, generator_length, 0);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_syndromes, 
+            syndromes + l * generator_length, generator_length);
+        TEST_ASSERT_EQUAL_INT((l % 3) == 0, 
+            rs_check_if_error(syndromes + l * generator_length, 
+                generator_length));
+    }
+}
+
+void rs_bitslice_other_field_tests()
+{
+    // Round trip through a CCSDS (0x187) field code
+    static gf8_field_t ccsds_field;
+    TEST_ASSERT_EQUAL_INT(0, 
+        gf8_field_init(&ccsds_field, GF8_POLYNOMIAL_CCSDS));
+
+    uint8_t generator[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    static uint8_t syndromes[CODEWORD_COUNT * 17];
+
+    int message_length = 100;
+    int generator_length = 17;
+    rs_generator_polynomial(&ccsds_field, generator, working_buffer, 
+        generator_length);
+    rs_bitslice_init(&ccsds_field, &encoder, generator, generator_length);
+
+    fill_messages(message_length);
+    encode_expected(&ccsds_field, generator, message_length, 
+        generator_length);
+    rs_bitslice_encode_batch(&encoder, codewords, STRIDE, 
+        message_length, CODEWORD_COUNT, planes);
+    for(int l = 0; l < CODEWORD_COUNT; l++) {
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected + l * STRIDE, 
+            codewords + l * STRIDE, message_length + generator_length - 1);
+    }
+
+    rs_bitslice_calc_syndromes_batch(&encoder, syndromes, codewords, 
+        STRIDE, message_length + generator_length - 1, CODEWORD_COUNT, 
+        planes);
+    for(int l = 0; l < CODEWORD_COUNT; l++) {
+        TEST_ASSERT_EQUAL_INT(0, rs_check_if_error(
+            syndromes + l * generator_length, generator_length));
+    }
+}
+
+// Puts errors errors into codeword l, all at different positions
+static void corrupt_codeword(int l, int codeword_length, int errors)
+{
+    for(int j = 0; j < errors; j++) {
+        int position = (l * 7 + j * 37) % codeword_length;
+        codewords[l * STRIDE + position] ^= (uint8_t)((l + j) % 255 + 1);
+    }
+}
+
+// Codec for the batch decoder, with room for the biggest code tried
+static rs_codec_t codec;
+static uint8_t codec_memory[65536];
+static uint8_t corrupted[CODEWORD_COUNT * STRIDE];
+static uint64_t decode_planes[
+    RS_BITSLICE_DECODE_PLANES(RS_BITSLICE_MAX_CODEWORD)];
+
+// Simple repeatable pseudo random numbers for codes and error patterns
+static uint32_t bitslice_test_random(uint32_t* state)
+{
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 16;
+}
+
+// Runs the batch decoder over the first count codewords, which have to 
+// be in corrupted as well, and checks every one came out exactly like 
+// rs_codec_decode leaves it
+static void decode_batch_check(int count)
+{
+    int results[CODEWORD_COUNT];
+    int k = codec.k;
+    TEST_ASSERT_EQUAL_INT(0, rs_decode_batch(&codec, codewords, STRIDE, 
+        count, results, decode_planes));
+    for(int l = 0; l < count; l++) {
+        uint8_t* codeword = corrupted + l * STRIDE;
+        TEST_ASSERT_EQUAL_INT(rs_codec_decode(&codec, codeword, 
+            codeword + k), results[l]);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(codeword, codewords + l * STRIDE, 
+            codec.n);
+    }
+}
+
+// Encodes random data into codeword l with the codec and gives it 
+// errors errors at random different positions
+static void random_codeword(int l, int errors, uint32_t* state)
+{
+    uint8_t* codeword = codewords + l * STRIDE;
+    uint8_t hit[STRIDE] = {0};
+    for(int i = 0; i < codec.k; i++) {
+        codeword[i] = (uint8_t)bitslice_test_random(state);
+    }
+    rs_codec_encode(&codec, codeword, codeword + codec.k);
+    for(int j = 0; j < errors && j < codec.n; j++) {
+        int position;
+        do {
+            position = (int)(bitslice_test_random(state) % codec.n);
+        } while(hit[position]);
+        hit[position] = 1;
+        codeword[position] ^= (uint8_t)(bitslice_test_random(state) % 255 
+            + 1);
+    }
+    for(int i = 0; i < codec.n; i++) {
+        corrupted[l * STRIDE + i] = codeword[i];
+    }
+}
+
+// Encodes every codeword with a codec, gives codeword l (l % cycle) 
+// errors, then checks the batch decoder fixes the ones it can and 
+// agrees with rs_codec_decode on all of them
+static void decode_batch_round_trip(const gf8_field_t* f, 
+    int message_length, int generator_length, int cycle, int fcr, int prim)
+{
+    int codeword_length = message_length + generator_length - 1;
+    int max_errors = (generator_length - 1) / 2;
+
+    TEST_ASSERT_TRUE(rs_codec_memory_size(codeword_length, message_length, 
+        0) <= sizeof(codec_memory));
+    TEST_ASSERT_EQUAL_INT(0, rs_codec_init(&codec, f, codeword_length, 
+        message_length, fcr, prim, codec_memory, 0));
+    fill_messages(message_length);
+    for(int l = 0; l < CODEWORD_COUNT; l++) {
+        uint8_t* codeword = codewords + l * STRIDE;
+        rs_codec_encode(&codec, codeword, codeword + message_length);
+        for(int i = 0; i < codeword_length; i++) {
+            expected[l * STRIDE + i] = codeword[i];
+        }
+        corrupt_codeword(l, codeword_length, l % cycle);
+        for(int i = 0; i < codeword_length; i++) {
+            corrupted[l * STRIDE + i] = codeword[i];
+        }
+    }
+
+    decode_batch_check(CODEWORD_COUNT);
+    for(int l = 0; l < CODEWORD_COUNT; l++) {
+        if(l % cycle <= max_errors) {
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(expected + l * STRIDE, 
+                codewords + l * STRIDE, codeword_length);
+        }
+    }
+}
+
+// Batches where only a lane or a few end up in the last group, which is
+// where the decoder has the fewest lanes to go on
+static void decode_batch_short_groups(int n, int k, int errors)
+{
+    uint32_t state = (uint32_t)(n * 256 + errors);
+    TEST_ASSERT_EQUAL_INT(0, rs_codec_init(&codec, field, n, k, 0, 1, 
+        codec_memory, 0));
+    int counts[] = { 1, 2, 3, RS_BITSLICE_LANES + 1, RS_BITSLICE_LANES + 3 };
+    for(int c = 0; c < 5; c++) {
+        for(int l = 0; l < counts[c]; l++) {
+            random_codeword(l, errors, &state);
+        }
+        decode_batch_check(counts[c]);
+    }
+}
+
+void rs_decode_batch_tests()
+{
+    // 0 up to t + 1 errors across a few batches
+    decode_batch_round_trip(field, 223, 33, 18, 0, 1);
+    // Odd number of parity symbols, shortened
+    decode_batch_round_trip(field, 40, 12, 7, 0, 1);
+    // Only one parity symbol can't fix anything, but still spots errors
+    decode_batch_round_trip(field, 10, 2, 2, 0, 1);
+    // Roots that don't start at alpha^0 or step by alpha
+    decode_batch_round_trip(field, 100, 17, 10, 1, 1);
+    decode_batch_round_trip(field, 100, 17, 10, 120, 7);
+    // Far more errors than t, so some locators need more than t terms
+    decode_batch_round_trip(field, 100, 17, 40, 0, 1);
+
+    // A single word or a short last group with more than one error 
+    // each, up to t
+    for(int errors = 2; errors <= 16; errors++) {
+        decode_batch_short_groups(255, 223, errors);
+    }
+    decode_batch_short_groups(10, 5, 2);
+    decode_batch_short_groups(157, 147, 5);
+
+    // All clean, nothing gets touched
+    int results[CODEWORD_COUNT];
+    rs_codec_init(&codec, field, 26, 16, 0, 1, codec_memory, 0);
+    fill_messages(16);
+    for(int l = 0; l < CODEWORD_COUNT; l++) {
+        rs_codec_encode(&codec, codewords + l * STRIDE, 
+            codewords + l * STRIDE + 16);
+    }
+    for(int i = 0; i < CODEWORD_COUNT * STRIDE; i++) {
+        expected[i] = codewords[i];
+    }
+    TEST_ASSERT_EQUAL_INT(0, rs_decode_batch(&codec, codewords, STRIDE, 
+        CODEWORD_COUNT, results, decode_planes));
+    for(int l = 0; l < CODEWORD_COUNT; l++) {
+        TEST_ASSERT_EQUAL_INT(0, results[l]);
+    }
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, codewords, 
+        CODEWORD_COUNT * STRIDE);
+
+    // Codewords can't overlap
+    TEST_ASSERT_EQUAL_INT(-1, rs_decode_batch(&codec, codewords, 20, 
+        CODEWORD_COUNT, results, decode_planes));
+}
+
+void rs_decode_batch_random_tests()
+{
+    // Random codes, batch sizes and error counts, some of them past t. 
+    // Half the batches are only a few words long.
+    static const int prims[] = { 1, 2, 7, 11, 13, 29, 254 };
+    uint32_t state = 11;
+    for(int trial = 0; trial < 300; trial++) {
+        int number_of_symbols = 1 + (int)(bitslice_test_random(&state) % 32);
+        int k = 1 + (int)(bitslice_test_random(&state) % 
+            (255 - number_of_symbols));
+        int fcr = (int)(bitslice_test_random(&state) % 255);
+        int prim = prims[bitslice_test_random(&state) % 7];
+        TEST_ASSERT_EQUAL_INT(0, rs_codec_init(&codec, field, 
+            k + number_of_symbols, k, fcr, prim, codec_memory, 0));
+
+        int count = 1 + (int)(bitslice_test_random(&state) % 
+            ((trial & 1) ? 4 : CODEWORD_COUNT));
+        for(int l = 0; l < count; l++) {
+            int errors = (int)(bitslice_test_random(&state) % 
+                (number_of_symbols / 2 + 3));
+            random_codeword(l, errors, &state);
+        }
+        decode_batch_check(count);
+    }
+}
+
+void rs_decode_batch_other_field_tests()
+{
+    static gf8_field_t other_field;
+    TEST_ASSERT_EQUAL_INT(0, 
+        gf8_field_init(&other_field, GF8_POLYNOMIAL_CCSDS));
+    decode_batch_round_trip(&other_field, 100, 17, 10, 0, 1);
+    // The CCSDS code itself
+    decode_batch_round_trip(&other_field, 223, 33, 18, 112, 11);
+    TEST_ASSERT_EQUAL_INT(0, 
+        gf8_field_init(&other_field, GF8_POLYNOMIAL_AES));
+    decode_batch_round_trip(&other_field, 100, 17, 10, 0, 1);
+}
@@ -0,0 +1,15 @@
+#ifndef _RS_BITSLICE_TESTS_H_
+#define _RS_BITSLICE_TESTS_H_
+
+void rs_bitslice_transpose_tests();
+
+void rs_bitslice_encode_tests();
+void rs_bitslice_calc_syndromes_tests();
+
+void rs_bitslice_other_field_tests();
+
+void rs_decode_batch_tests();
+void rs_decode_batch_random_tests();
+void rs_decode_batch_other_field_tests();
+
+#endif
@@ -0,0 +1,154 @@
+#include "unity/unity.h"
+#include "rs_ec_16_tests.h"
+#include "../rs_ec_16.h"
+
+static gf16_field_t gf16_field;
+static const gf16_field_t* field = &gf16_field;
+
+// Big enough for the longest codeword
+static uint16_t buffer[GF16_ORDER];
+static uint16_t message_buffer[GF16_ORDER];
+
+#define MAX_GENERATOR_LENGTH 65
+
+static void rs16_tests_field_init()
+{
+    if(gf16_field.polynomial != GF16_POLYNOMIAL_DEFAULT) {
+        TEST_ASSERT_EQUAL_INT(0, 
+            gf16_field_init(&gf16_field, GF16_POLYNOMIAL_DEFAULT));
+    }
+}
+
+void rs16_generator_polynomial_tests()
+{
+    rs16_tests_field_init();
+    uint16_t generator[MAX_GENERATOR_LENGTH];
+
+    // Trivial case, (x - 1)
+    int result = rs16_generator_polynomial(field, generator, 2);
+    TEST_ASSERT_EQUAL_INT(0, result);
+    TEST_ASSERT_EQUAL_HEX16(1, generator[0]);
+    TEST_ASSERT_EQUAL_HEX16(1, generator[1]);
+
+    // (x - 1)(x - 2) = x^2 + 3x + 2, same as in GF(2^8)
+    result = rs16_generator_polynomial(field, generator, 3);
+    TEST_ASSERT_EQUAL_INT(0, result);
+    TEST_ASSERT_EQUAL_HEX16(1, generator[0]);
+    TEST_ASSERT_EQUAL_HEX16(3, generator[1]);
+    TEST_ASSERT_EQUAL_HEX16(2, generator[2]);
+
+    // Every alpha^i is a root and alpha^nsym isn't
+    result = rs16_generator_polynomial(field, generator, 
+        MAX_GENERATOR_LENGTH);
+    TEST_ASSERT_EQUAL_INT(0, result);
+    for(int i = 0; i < MAX_GENERATOR_LENGTH - 1; i++) {
+        TEST_ASSERT_EQUAL_HEX16(0, gf16_poly_eval(field, generator, 
+            field->exp[i], MAX_GENERATOR_LENGTH));
+    }
+    TEST_ASSERT_NOT_EQUAL(0, gf16_poly_eval(field, generator, 
+        field->exp[MAX_GENERATOR_LENGTH - 1], MAX_GENERATOR_LENGTH));
+
+    TEST_ASSERT_EQUAL_INT(-1, rs16_generator_polynomial(field, generator, 0));
+}
+
+void rs16_encode_tests()
+{
+    rs16_tests_field_init();
+    uint16_t generator[5];
+    uint16_t inplace[20];
+
+    // The wikiversity message, just with 16 bit symbols. 
+    // The parity is a multiple of the generator so dividing by it
+    // has to come out clean.
+    uint16_t message[] = { 
+        0x40d2, 0x7547, 0x7617, 0x3206, 0x2726, 0x96c6, 0xc696, 0x70ec };
+    int message_length = sizeof(message) / sizeof(message[0]);
+
+    rs16_generator_polynomial(field, generator, 5);
+    int result = rs16_encode(field, buffer, message, message_length, 
+        generator, 5);
+    TEST_ASSERT_EQUAL_INT(0, result);
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(message, buffer, message_length);
+
+    // The codeword has all the generator's roots
+    for(int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_HEX16(0, gf16_poly_eval(field, buffer, 
+            field->exp[i], message_length + 4));
+    }
+
+    // Encoding in place gives the same thing
+    for(int i = 0; i < message_length; i++) {
+        inplace[i] = message[i];
+    }
+    result = rs16_encode(field, inplace, inplace, message_length, 
+        generator, 5);
+    TEST_ASSERT_EQUAL_INT(0, result);
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(buffer, inplace, message_length + 4);
+
+    // Too long for the field
+    result = rs16_encode(field, buffer, message_buffer, GF16_ORDER - 3, 
+        generator, 5);
+    TEST_ASSERT_EQUAL_INT(-1, result);
+}
+
+void rs16_encode_long_tests()
+{
+    rs16_tests_field_init();
+    uint16_t generator[MAX_GENERATOR_LENGTH];
+    uint16_t syndromes[MAX_GENERATOR_LENGTH];
+
+    // Full length codeword, 65535 - 64 message symbols plus 64 parity
+    int generator_length = MAX_GENERATOR_LENGTH;
+    int message_length = GF16_ORDER - (generator_length - 1);
+    for(int i = 0; i < message_length; i++) {
+        message_buffer[i] = (uint16_t)(i * 2654435761u >> 7);
+    }
+
+    rs16_generator_polynomial(field, generator, generator_length);
+    int result = rs16_encode(field, buffer, message_buffer, message_length, 
+        generator, generator_length);
+    TEST_ASSERT_EQUAL_INT(0, result);
+
+    result = rs16_calc_syndromes(field, syndromes, buffer, GF16_ORDER, 
+        generator_length);
+    TEST_ASSERT_EQUAL_INT(0, result);
+    TEST_ASSERT_EQUAL_INT(0, rs16_check_if_error(syndromes, generator_length));
+
+    // Errors at either end of a long codeword get noticed
+    buffer[0] ^= 0x0100;
+    rs16_calc_syndromes(field, syndromes, buffer, GF16_ORDER, 
+        generator_length);
+    TEST_ASSERT_EQUAL_INT(1, rs16_check_if_error(syndromes, generator_length));
+
+    buffer[0] ^= 0x0100;
+    buffer[GF16_ORDER - 1] ^= 0x8001;
+    rs16_calc_syndromes(field, syndromes, buffer, GF16_ORDER, 
+        generator_length);
+    TEST_ASSERT_EQUAL_INT(1, rs16_check_if_error(syndromes, generator_length));
+}
+
+void rs16_calc_syndromes_tests()
+{
+    rs16_tests_field_init();
+    uint16_t syndromes[5];
+
+    // A single error e at position j (counting from the end) 
+    // gives syndromes e * alpha^(i*j)
+    for(int i = 0; i < 1000; i++) {
+        buffer[i] = 0;
+    }
+    buffer[1000 - 1 - 10] = 0x1234;
+
+    int result = rs16_calc_syndromes(field, syndromes, buffer, 1000, 5);
+    TEST_ASSERT_EQUAL_INT(0, result);
+    TEST_ASSERT_EQUAL_HEX16(0, syndromes[0]);
+    for(int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_HEX16(
+            gf16_mul(field, 0x1234, gf16_pow(field, 2, i * 10)), 
+            syndromes[i + 1]);
+    }
+
+    // Too long for the field
+    TEST_ASSERT_EQUAL_INT(-1, 
+        rs16_calc_syndromes(field, syndromes, buffer, GF16_ORDER + 1, 5));
+}
@@ -0,0 +1,11 @@
+#ifndef _RS_EC_16_TESTS_H_
+#define _RS_EC_16_TESTS_H_
+
+void rs16_generator_polynomial_tests();
+
+void rs16_encode_tests();
+void rs16_encode_long_tests();
+
+void rs16_calc_syndromes_tests();
+
+#endif
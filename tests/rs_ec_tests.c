@@ -1,9 +1,23 @@
 #include "unity/unity.h"
 #include "rs_ec_tests.h"
 #include "../rs_ec.h"
+#include <string.h>
+
+// Everything here is in the usual 0x11D field
+static const gf8_field_t* field = &gf8_field_default;
 
 #define BUFFER_SIZE 512
 
+// Big enough to decode with every generator length used here
+static uint8_t decode_buffer[RS_DECODE_BUFFER_SIZE(64)];
+
+// Simple repeatable pseudo random numbers for picking error patterns
+static uint32_t rs_test_random(uint32_t* state)
+{
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 16;
+}
+
 
 
 void rs_generator_polynomial_tests()
@@ -12,14 +26,14 @@ void rs_generator_polynomial_tests()
     uint8_t working_buffer[BUFFER_SIZE] = {0};
 
     // Trivial case
-    int result = rs_generator_polynomial(buffer, working_buffer, 2);
+    int result = rs_generator_polynomial(field, buffer, working_buffer, 2);
 
     TEST_ASSERT_EQUAL_INT8(0, result);
     TEST_ASSERT_EQUAL_HEX8(1, buffer[0]);
     TEST_ASSERT_EQUAL_HEX8(1, buffer[1]);
 
     // Slightly more complicated case
-    result = rs_generator_polynomial(buffer, working_buffer, 3);
+    result = rs_generator_polynomial(field, buffer, working_buffer, 3);
 
     TEST_ASSERT_EQUAL_INT8(0, result);
     TEST_ASSERT_EQUAL_HEX8(1, buffer[0]);
@@ -28,7 +42,7 @@ void rs_generator_polynomial_tests()
 
     // Shamelessly taken from the wikiversity page
     // I didn't want to do the math myself
-    result = rs_generator_polynomial(buffer, working_buffer, 5);
+    result = rs_generator_polynomial(field, buffer, working_buffer, 5);
 
     TEST_ASSERT_EQUAL_INT8(0, result);
     TEST_ASSERT_EQUAL_HEX8(1, buffer[0]);
@@ -52,7 +66,7 @@ void rs_encode_tests()
 
     // The scenerio uses 10 symbols, which is a buffer of 11.
     int polynomialLength = 11;
-    rs_generator_polynomial(generator_polynomial_buffer, 
+    rs_generator_polynomial(field, generator_polynomial_buffer, 
         working_buffer, polynomialLength);
 
     // Copy message to message_buffer
@@ -61,7 +75,7 @@ void rs_encode_tests()
     }
 
     // Do the actual encoding
-    int result = rs_encode(buffer, working_buffer, 
+    int result = rs_encode(field, buffer, working_buffer, 
         message_buffer, sizeof(message), 
         generator_polynomial_buffer, polynomialLength);
 
@@ -95,7 +109,7 @@ void rs_encode_tests_2()
 
     // The scenerio uses 14 symbols, which is a buffer of 15.
     int polynomialLength = 15;
-    rs_generator_polynomial(generator_polynomial_buffer, 
+    rs_generator_polynomial(field, generator_polynomial_buffer, 
         working_buffer, polynomialLength);
 
     // Copy message to message_buffer
@@ -104,7 +118,7 @@ void rs_encode_tests_2()
     }
 
     // Do the actual encoding
-    int result = rs_encode(buffer, working_buffer, 
+    int result = rs_encode(field, buffer, working_buffer, 
         message_buffer, sizeof(message), 
         generator_polynomial_buffer, polynomialLength);
 
@@ -142,8 +156,8 @@ void rs_calc_syndromes_tests()
 
     // The scenerio uses 14 symbols, which is a buffer of 15.
     int generator_length = 15;
-    int result = rs_calc_syndromes(buffer, message, 
-        message_size, generator_length);
+    int result = rs_calc_syndromes(field, buffer, message, 
+        message_size, generator_length, 0);
 
     TEST_ASSERT_EQUAL_INT8(0, result);
 
@@ -173,8 +187,8 @@ void rs_calc_syndromes_tests_2()
 
     // The scenerio uses 14 symbols, which is a buffer of 15.
     int generator_length = 15;
-    int result = rs_calc_syndromes(buffer, message, 
-        message_size, generator_length);
+    int result = rs_calc_syndromes(field, buffer, message, 
+        message_size, generator_length, 0);
     TEST_ASSERT_EQUAL_INT8(0, result);
 
     uint8_t expected_syndrome[] = {
@@ -207,4 +221,1070 @@ void rs_check_if_error_tests()
 
     result = rs_check_if_error(syndromes2, sizeof(syndromes2));
     TEST_ASSERT_EQUAL_INT8(0, result);
-}
\ No newline at end of file
+}
+void rs_other_field_tests()
+{
+    // Round trip a message through a CCSDS (0x187) field code
+    static gf8_field_t ccsds_field;
+    TEST_ASSERT_EQUAL_INT(0, 
+        gf8_field_init(&ccsds_field, GF8_POLYNOMIAL_CCSDS));
+
+    uint8_t buffer[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    uint8_t generator_polynomial_buffer[BUFFER_SIZE] = {0};
+    uint8_t message_buffer[BUFFER_SIZE] = {0};
+    uint8_t syndromes[BUFFER_SIZE] = {0};
+
+    for(int i = 0; i < 40; i++) {
+        message_buffer[i] = (uint8_t)(i * 7 + 3);
+    }
+
+    int generator_length = 17;
+    int result = rs_generator_polynomial(&ccsds_field, 
+        generator_polynomial_buffer, working_buffer, generator_length);
+    TEST_ASSERT_EQUAL_INT8(0, result);
+
+    result = rs_encode(&ccsds_field, buffer, working_buffer, 
+        message_buffer, 40, generator_polynomial_buffer, generator_length);
+    TEST_ASSERT_EQUAL_INT8(0, result);
+
+    int codeword_length = 40 + generator_length - 1;
+    result = rs_calc_syndromes(&ccsds_field, syndromes, buffer, 
+        codeword_length, generator_length, 0);
+    TEST_ASSERT_EQUAL_INT8(0, result);
+    TEST_ASSERT_EQUAL_INT8(0, rs_check_if_error(syndromes, generator_length));
+
+    // The parity shouldn't be the same as in the default field, 
+    // and the default field should see the codeword as corrupt.
+    uint8_t default_buffer[BUFFER_SIZE] = {0};
+    rs_generator_polynomial(field, generator_polynomial_buffer, 
+        working_buffer, generator_length);
+    rs_encode(field, default_buffer, working_buffer, message_buffer, 40, 
+        generator_polynomial_buffer, generator_length);
+    TEST_ASSERT_TRUE(memcmp(buffer, default_buffer, codeword_length) != 0);
+
+    rs_calc_syndromes(field, syndromes, buffer, 
+        codeword_length, generator_length, 0);
+    TEST_ASSERT_EQUAL_INT8(1, rs_check_if_error(syndromes, generator_length));
+
+    // Corrupting a byte gets noticed in the CCSDS field as well
+    buffer[3] ^= 0x40;
+    rs_calc_syndromes(&ccsds_field, syndromes, buffer, 
+        codeword_length, generator_length, 0);
+    TEST_ASSERT_EQUAL_INT8(1, rs_check_if_error(syndromes, generator_length));
+}
+
+void rs_encoder_tests()
+{
+    static uint8_t table[RS_ENCODER_MAX_SLICES * 256 * 32];
+    uint8_t buffer[BUFFER_SIZE] = {0};
+    uint8_t expected[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    uint8_t generator_polynomial_buffer[BUFFER_SIZE] = {0};
+    uint8_t message_buffer[BUFFER_SIZE] = {0};
+    rs_encoder_t encoder;
+
+    for(int i = 0; i < 255; i++) {
+        message_buffer[i] = (uint8_t)(i * 167 + 13);
+    }
+
+    int generator_lengths[] = { 2, 11, 33 };
+    for(int g = 0; g < 3; g++) {
+        int generator_length = generator_lengths[g];
+        int number_of_symbols = generator_length - 1;
+        rs_generator_polynomial(field, generator_polynomial_buffer, 
+            working_buffer, generator_length);
+
+        for(int slices = 1; slices <= RS_ENCODER_MAX_SLICES; slices++) {
+            if(slices > number_of_symbols) {
+                // Slices have to fit in the remainder
+                TEST_ASSERT_EQUAL_INT(-1, rs_encoder_init(field, &encoder, 
+                    table, generator_polynomial_buffer, generator_length, 
+                    slices));
+                continue;
+            }
+            TEST_ASSERT_TRUE(rs_encoder_table_size(generator_length, 
+                slices) <= sizeof(table));
+            TEST_ASSERT_EQUAL_INT(0, rs_encoder_init(field, &encoder, table, 
+                generator_polynomial_buffer, generator_length, slices));
+
+            // Lengths that do and don't divide evenly into the slices
+            int message_lengths[] = { 1, 7, 16, 100, 
+                255 - number_of_symbols };
+            for(int m = 0; m < 5; m++) {
+                int message_length = message_lengths[m];
+
+                TEST_ASSERT_EQUAL_INT(0, rs_encode(field, expected, 
+                    working_buffer, message_buffer, message_length, 
+                    generator_polynomial_buffer, generator_length));
+
+                TEST_ASSERT_EQUAL_INT(0, rs_encoder_encode(&encoder, buffer, 
+                    message_buffer, message_length));
+                TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, buffer, 
+                    message_length + number_of_symbols);
+
+                // In place
+                for(int i = 0; i < message_length; i++) {
+                    buffer[i] = message_buffer[i];
+                }
+                TEST_ASSERT_EQUAL_INT(0, rs_encoder_encode(&encoder, buffer, 
+                    buffer, message_length));
+                TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, buffer, 
+                    message_length + number_of_symbols);
+            }
+
+            // Too long
+            TEST_ASSERT_EQUAL_INT(-1, rs_encoder_encode(&encoder, buffer, 
+                message_buffer, 256 - number_of_symbols));
+        }
+    }
+
+    // Bad parameters
+    TEST_ASSERT_EQUAL_INT(-1, rs_encoder_init(field, &encoder, table, 
+        generator_polynomial_buffer, 1, 1));
+    TEST_ASSERT_EQUAL_INT(-1, rs_encoder_init(field, &encoder, table, 
+        generator_polynomial_buffer, 33, 0));
+    TEST_ASSERT_EQUAL_INT(-1, rs_encoder_init(field, &encoder, table, 
+        generator_polynomial_buffer, 33, RS_ENCODER_MAX_SLICES + 1));
+}
+
+void rs_parity_matrix_tests()
+{
+    static uint8_t matrix[255 * 64];
+    uint8_t buffer[BUFFER_SIZE] = {0};
+    uint8_t expected[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    uint8_t generator_polynomial_buffer[BUFFER_SIZE] = {0};
+    uint8_t message_buffer[BUFFER_SIZE] = {0};
+    rs_parity_matrix_t parity_matrix;
+
+    for(int i = 0; i < 255; i++) {
+        message_buffer[i] = (uint8_t)(i * 89 + 5);
+    }
+
+    // (255, 223), (255, 239), (204, 188) and one with a padded out row
+    int message_lengths[] = { 223, 239, 188, 100 };
+    int generator_lengths[] = { 33, 17, 17, 24 };
+    for(int c = 0; c < 4; c++) {
+        int k = message_lengths[c];
+        int generator_length = generator_lengths[c];
+        int number_of_symbols = generator_length - 1;
+        rs_generator_polynomial(field, generator_polynomial_buffer, 
+            working_buffer, generator_length);
+
+        TEST_ASSERT_TRUE(rs_parity_matrix_size(k, generator_length) <= 
+            sizeof(matrix));
+        TEST_ASSERT_EQUAL_INT(0, rs_parity_matrix_init(field, 
+            &parity_matrix, matrix, generator_polynomial_buffer, 
+            generator_length, k));
+
+        // Full length and shorter messages
+        int lengths[] = { k, k - 1, 1, k / 3 };
+        for(int l = 0; l < 4; l++) {
+            int message_length = lengths[l];
+            uint8_t in_place[BUFFER_SIZE] = {0};
+            for(int i = 0; i < message_length; i++) {
+                in_place[i] = message_buffer[i];
+            }
+            TEST_ASSERT_EQUAL_INT(0, rs_encode(field, expected, 
+                working_buffer, message_buffer, message_length, 
+                generator_polynomial_buffer, generator_length));
+
+            TEST_ASSERT_EQUAL_INT(0, rs_parity_matrix_encode(&parity_matrix, 
+                buffer, message_buffer, message_length));
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, buffer, 
+                message_length + number_of_symbols);
+
+            // In place
+            TEST_ASSERT_EQUAL_INT(0, rs_parity_matrix_encode(&parity_matrix, 
+                in_place, in_place, message_length));
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, in_place, 
+                message_length + number_of_symbols);
+        }
+
+        // Longer than the matrix was built for
+        TEST_ASSERT_EQUAL_INT(-1, rs_parity_matrix_encode(&parity_matrix, 
+            buffer, message_buffer, k + 1));
+    }
+
+    // Doesn't fit in a codeword
+    TEST_ASSERT_EQUAL_INT(-1, rs_parity_matrix_init(field, &parity_matrix, 
+        matrix, generator_polynomial_buffer, 33, 224));
+}
+
+void rs_encode_parity_tests()
+{
+    static uint8_t table[RS_ENCODER_MAX_SLICES * 256 * 32];
+    static uint8_t matrix[255 * 32];
+    uint8_t expected[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    uint8_t generator_polynomial_buffer[BUFFER_SIZE] = {0};
+    uint8_t message_buffer[BUFFER_SIZE] = {0};
+    uint8_t untouched[BUFFER_SIZE] = {0};
+    rs_encoder_t encoder;
+    rs_parity_matrix_t parity_matrix;
+
+    for(int i = 0; i < 255; i++) {
+        message_buffer[i] = (uint8_t)(i * 59 + 3);
+    }
+    memcpy(untouched, message_buffer, sizeof(message_buffer));
+
+    int message_lengths[] = { 223, 239, 100, 1 };
+    int generator_lengths[] = { 33, 17, 2, 11 };
+    for(int c = 0; c < 4; c++) {
+        int k = message_lengths[c];
+        int generator_length = generator_lengths[c];
+        int number_of_symbols = generator_length - 1;
+        rs_generator_polynomial(field, generator_polynomial_buffer, 
+            working_buffer, generator_length);
+
+        TEST_ASSERT_EQUAL_INT(0, rs_encode(field, expected, working_buffer, 
+            message_buffer, k, generator_polynomial_buffer, 
+            generator_length));
+
+        // The parity goes somewhere else and the message is left alone,
+        // including what comes after it
+        uint8_t parity[BUFFER_SIZE];
+        memset(parity, 0xAA, sizeof(parity));
+        TEST_ASSERT_EQUAL_INT(0, rs_encode_parity(field, parity, 
+            message_buffer, k, generator_polynomial_buffer, 
+            generator_length));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected + k, parity, 
+            number_of_symbols);
+        TEST_ASSERT_EQUAL_HEX8(0xAA, parity[number_of_symbols]);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(untouched, message_buffer, 
+            sizeof(message_buffer));
+
+        rs_encoder_init(field, &encoder, table, generator_polynomial_buffer, 
+            generator_length, 1);
+        memset(parity, 0xAA, sizeof(parity));
+        TEST_ASSERT_EQUAL_INT(0, rs_encoder_encode_parity(&encoder, parity, 
+            message_buffer, k));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected + k, parity, 
+            number_of_symbols);
+        TEST_ASSERT_EQUAL_HEX8(0xAA, parity[number_of_symbols]);
+
+        rs_parity_matrix_init(field, &parity_matrix, matrix, 
+            generator_polynomial_buffer, generator_length, k);
+        memset(parity, 0xAA, sizeof(parity));
+        TEST_ASSERT_EQUAL_INT(0, rs_parity_matrix_encode_parity(
+            &parity_matrix, parity, message_buffer, k));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected + k, parity, 
+            number_of_symbols);
+        TEST_ASSERT_EQUAL_HEX8(0xAA, parity[number_of_symbols]);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(untouched, message_buffer, 
+            sizeof(message_buffer));
+    }
+
+    // Doesn't fit in a codeword
+    uint8_t parity[BUFFER_SIZE];
+    TEST_ASSERT_EQUAL_INT(-1, rs_encode_parity(field, parity, 
+        message_buffer, 224, generator_polynomial_buffer, 33));
+    TEST_ASSERT_EQUAL_INT(-1, rs_encode_parity(field, parity, 
+        message_buffer, 0, generator_polynomial_buffer, 33));
+}
+
+void rs_encoder_state_tests()
+{
+    static uint8_t table[RS_ENCODER_MAX_SLICES * 256 * 32];
+    uint8_t expected[BUFFER_SIZE] = {0};
+    uint8_t parity[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    uint8_t generator_polynomial_buffer[BUFFER_SIZE] = {0};
+    uint8_t message_buffer[BUFFER_SIZE] = {0};
+    uint8_t garbage[BUFFER_SIZE];
+    rs_encoder_t encoder;
+    rs_encoder_state_t state;
+    rs_encoder_state_t checkpoint;
+    uint32_t seed = 23;
+
+    int k = 223;
+    int generator_length = 33;
+    for(int i = 0; i < k; i++) {
+        message_buffer[i] = (uint8_t)rs_test_random(&seed);
+        garbage[i] = (uint8_t)rs_test_random(&seed);
+    }
+    rs_generator_polynomial(field, generator_polynomial_buffer, 
+        working_buffer, generator_length);
+
+    for(int slices = 1; slices <= RS_ENCODER_MAX_SLICES; slices++) {
+        rs_encoder_init(field, &encoder, table, generator_polynomial_buffer, 
+            generator_length, slices);
+        rs_encoder_encode_parity(&encoder, expected, message_buffer, k);
+
+        // Random piece sizes, including empty ones
+        for(int round = 0; round < 8; round++) {
+            TEST_ASSERT_EQUAL_INT(0, rs_encoder_state_init(&state, 
+                &encoder));
+            int offset = 0;
+            while(offset < k) {
+                int length = rs_test_random(&seed) % 40;
+                if(length > k - offset) {
+                    length = k - offset;
+                }
+                TEST_ASSERT_EQUAL_INT(0, rs_encoder_state_update(&state, 
+                    message_buffer + offset, length));
+                offset += length;
+            }
+            TEST_ASSERT_EQUAL_INT(0, rs_encoder_state_finalize(&state, 
+                parity));
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, parity, 
+                generator_length - 1);
+        }
+    }
+
+    // Nothing fed in yet
+    rs_encoder_state_init(&state, &encoder);
+    TEST_ASSERT_EQUAL_INT(-1, rs_encoder_state_finalize(&state, parity));
+
+    // Checkpoint halfway, go off with the wrong data, then restore
+    rs_encoder_state_update(&state, message_buffer, 100);
+    checkpoint = state;
+    rs_encoder_state_update(&state, garbage, 50);
+    state = checkpoint;
+    rs_encoder_state_update(&state, message_buffer + 100, k - 100);
+    rs_encoder_state_finalize(&state, parity);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, parity, generator_length - 1);
+
+    // Partway through is the parity of the message so far
+    uint8_t prefix_parity[BUFFER_SIZE];
+    rs_encoder_encode_parity(&encoder, prefix_parity, message_buffer, 100);
+    checkpoint.encoder = &encoder;
+    rs_encoder_state_finalize(&checkpoint, parity);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(prefix_parity, parity, 
+        generator_length - 1);
+
+    // Too long for a codeword, and the state is left alone
+    TEST_ASSERT_EQUAL_INT(-1, rs_encoder_state_update(&state, garbage, 1));
+    TEST_ASSERT_EQUAL_INT(k, state.message_length);
+    TEST_ASSERT_EQUAL_INT(-1, rs_encoder_state_update(&state, garbage, -1));
+}
+
+void rs_calc_syndromes_matrix_tests()
+{
+    static uint8_t matrix[255 * 32];
+    uint8_t buffer[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    uint8_t generator_polynomial_buffer[BUFFER_SIZE] = {0};
+    uint8_t syndromes[BUFFER_SIZE] = {0};
+    uint8_t expected[BUFFER_SIZE] = {0};
+    rs_parity_matrix_t parity_matrix;
+
+    int generator_length = 33;
+    int message_length = 223;
+    int codeword_length = 255;
+    rs_generator_polynomial(field, generator_polynomial_buffer, 
+        working_buffer, generator_length);
+    rs_parity_matrix_init(field, &parity_matrix, matrix, 
+        generator_polynomial_buffer, generator_length, message_length);
+
+    for(int i = 0; i < message_length; i++) {
+        buffer[i] = (uint8_t)(i * 53 + 1);
+    }
+    rs_parity_matrix_encode(&parity_matrix, buffer, buffer, message_length);
+
+    // Clean
+    memset(syndromes, 0xFF, sizeof(syndromes));
+    TEST_ASSERT_EQUAL_INT(0, rs_calc_syndromes(field, syndromes, buffer, 
+        codeword_length, generator_length, &parity_matrix));
+    for(int i = 0; i < generator_length; i++) {
+        TEST_ASSERT_EQUAL_HEX8(0, syndromes[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(0, rs_check_if_error(syndromes, generator_length));
+
+    // Errors in the message, in the parity, and both. The syndromes
+    // have to match evaluating the whole codeword.
+    int positions[] = { 0, 100, 222, 223, 254 };
+    for(int p = 0; p < 5; p++) {
+        buffer[positions[p]] ^= 0x5A;
+        if(p > 2) {
+            buffer[7] ^= 0x01;
+        }
+
+        rs_calc_syndromes(field, expected, buffer, 
+            codeword_length, generator_length, 0);
+        TEST_ASSERT_EQUAL_INT(0, rs_calc_syndromes(field, syndromes, buffer, 
+            codeword_length, generator_length, &parity_matrix));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, syndromes, generator_length);
+        TEST_ASSERT_EQUAL_INT(1, rs_check_if_error(syndromes, 
+            generator_length));
+
+        buffer[positions[p]] ^= 0x5A;
+        if(p > 2) {
+            buffer[7] ^= 0x01;
+        }
+    }
+
+    // Shortened codewords use the end of the matrix
+    rs_parity_matrix_encode(&parity_matrix, buffer, buffer, 20);
+    rs_calc_syndromes(field, syndromes, buffer, 52, generator_length, 
+        &parity_matrix);
+    TEST_ASSERT_EQUAL_INT(0, rs_check_if_error(syndromes, generator_length));
+    buffer[3] ^= 0x80;
+    rs_calc_syndromes(field, expected, buffer, 52, generator_length, 0);
+    rs_calc_syndromes(field, syndromes, buffer, 52, generator_length, 
+        &parity_matrix);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, syndromes, generator_length);
+
+    // Has to be longer than the parity, no longer than the matrix, and 
+    // for the same generator
+    TEST_ASSERT_EQUAL_INT(-1, rs_calc_syndromes(field, syndromes, buffer, 
+        32, generator_length, &parity_matrix));
+    TEST_ASSERT_EQUAL_INT(-1, rs_calc_syndromes(field, syndromes, buffer, 
+        256, generator_length, &parity_matrix));
+    TEST_ASSERT_EQUAL_INT(-1, rs_calc_syndromes(field, syndromes, buffer, 
+        52, 17, &parity_matrix));
+}
+
+// Corrupts count distinct symbols of a codeword
+static void rs_test_corrupt(uint8_t* codeword, int length, int count, 
+    uint32_t* state)
+{
+    uint8_t used[256] = {0};
+    for(int i = 0; i < count; i++) {
+        int position;
+        do {
+            position = rs_test_random(state) % length;
+        } while(used[position]);
+        used[position] = 1;
+        codeword[position] ^= (uint8_t)(rs_test_random(state) % 255 + 1);
+    }
+}
+
+// Encodes a message, corrupts it, and checks rs_decode puts it back
+static void rs_decode_round_trip(const gf8_field_t* f, int message_length, 
+    int generator_length, int errors, uint32_t* state)
+{
+    uint8_t buffer[BUFFER_SIZE] = {0};
+    uint8_t original[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    uint8_t generator_polynomial_buffer[BUFFER_SIZE] = {0};
+    uint8_t message_buffer[BUFFER_SIZE] = {0};
+    uint8_t syndromes[BUFFER_SIZE] = {0};
+    int codeword_length = message_length + generator_length - 1;
+
+    for(int i = 0; i < message_length; i++) {
+        message_buffer[i] = (uint8_t)rs_test_random(state);
+    }
+    rs_generator_polynomial(f, generator_polynomial_buffer, 
+        working_buffer, generator_length);
+    rs_encode(f, original, working_buffer, message_buffer, message_length, 
+        generator_polynomial_buffer, generator_length);
+
+    for(int i = 0; i < codeword_length; i++) {
+        buffer[i] = original[i];
+    }
+    rs_test_corrupt(buffer, codeword_length, errors, state);
+
+    rs_calc_syndromes(f, syndromes, buffer, codeword_length, 
+        generator_length, 0);
+    int result = rs_decode(f, buffer, codeword_length, syndromes, 
+        generator_length, decode_buffer);
+    TEST_ASSERT_EQUAL_INT(errors, result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(original, buffer, codeword_length);
+}
+
+void rs_decode_tests()
+{
+    uint32_t state = 1;
+
+    // (255, 223) with 0 up to t = 16 errors, a few patterns each
+    for(int errors = 0; errors <= 16; errors++) {
+        for(int trial = 0; trial < 4; trial++) {
+            rs_decode_round_trip(field, 223, 33, errors, &state);
+        }
+    }
+
+    // Odd parity counts and shortened codewords
+    for(int trial = 0; trial < 8; trial++) {
+        rs_decode_round_trip(field, 16, 11, 5, &state);
+        rs_decode_round_trip(field, 40, 10, 4, &state);
+        rs_decode_round_trip(field, 1, 3, 1, &state);
+    }
+
+    // The wikiversity message with a couple of errors
+    uint8_t buffer[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    uint8_t generator_polynomial_buffer[BUFFER_SIZE] = {0};
+    uint8_t syndromes[BUFFER_SIZE] = {0};
+    uint8_t message[BUFFER_SIZE] = { 
+        0x40, 0xd2, 0x75, 0x47, 0x76, 0x17, 0x32, 0x06,
+        0x27, 0x26, 0x96, 0xc6, 0xc6, 0x96, 0x70, 0xec };
+    rs_generator_polynomial(field, generator_polynomial_buffer, 
+        working_buffer, 11);
+    rs_encode(field, buffer, working_buffer, message, 16, 
+        generator_polynomial_buffer, 11);
+    buffer[0] = 0;
+    buffer[10] = 0x42;
+    rs_calc_syndromes(field, syndromes, buffer, 26, 11, 0);
+    TEST_ASSERT_EQUAL_INT(2, rs_decode(field, buffer, 26, syndromes, 11, 
+        decode_buffer));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(message, buffer, 16);
+}
+
+void rs_decode_too_many_errors_tests()
+{
+    uint32_t state = 7;
+    uint8_t buffer[BUFFER_SIZE] = {0};
+    uint8_t corrupted[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    uint8_t generator_polynomial_buffer[BUFFER_SIZE] = {0};
+    uint8_t message_buffer[BUFFER_SIZE] = {0};
+    uint8_t syndromes[BUFFER_SIZE] = {0};
+
+    rs_generator_polynomial(field, generator_polynomial_buffer, 
+        working_buffer, 33);
+    for(int i = 0; i < 223; i++) {
+        message_buffer[i] = (uint8_t)(i * 3);
+    }
+    rs_encode(field, buffer, working_buffer, message_buffer, 223, 
+        generator_polynomial_buffer, 33);
+
+    // Past t it either gives up and leaves the message alone, or lands
+    // on some other valid codeword. It never makes things up.
+    for(int trial = 0; trial < 20; trial++) {
+        for(int i = 0; i < 255; i++) {
+            corrupted[i] = buffer[i];
+        }
+        rs_test_corrupt(corrupted, 255, 17 + trial % 8, &state);
+
+        uint8_t before[BUFFER_SIZE];
+        for(int i = 0; i < 255; i++) {
+            before[i] = corrupted[i];
+        }
+        rs_calc_syndromes(field, syndromes, corrupted, 255, 33, 0);
+        int result = rs_decode(field, corrupted, 255, syndromes, 33, 
+            decode_buffer);
+        if(result < 0) {
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(before, corrupted, 255);
+        } else {
+            rs_calc_syndromes(field, syndromes, corrupted, 255, 33, 0);
+            TEST_ASSERT_EQUAL_INT(0, rs_check_if_error(syndromes, 33));
+        }
+    }
+
+    // Bad lengths
+    TEST_ASSERT_EQUAL_INT(-1, rs_decode(field, corrupted, 32, syndromes, 
+        33, decode_buffer));
+    TEST_ASSERT_EQUAL_INT(-1, rs_decode(field, corrupted, 256, syndromes, 
+        33, decode_buffer));
+}
+
+void rs_decode_other_field_tests()
+{
+    uint32_t state = 3;
+
+    // CCSDS polynomial, and AES where the generator is 3 instead of 2
+    static gf8_field_t other_field;
+    uint16_t polynomials[] = { GF8_POLYNOMIAL_CCSDS, GF8_POLYNOMIAL_AES };
+    for(int p = 0; p < 2; p++) {
+        TEST_ASSERT_EQUAL_INT(0, gf8_field_init(&other_field, polynomials[p]));
+        for(int errors = 0; errors <= 8; errors++) {
+            rs_decode_round_trip(&other_field, 100, 17, errors, &state);
+        }
+    }
+}
+
+// Encodes a message, erases and corrupts some of it, and checks 
+// rs_decode_erasures puts it back
+static void rs_decode_erasures_round_trip(const gf8_field_t* f, 
+    int message_length, int generator_length, int erasure_count, 
+    int errors, uint32_t* state)
+{
+    uint8_t buffer[BUFFER_SIZE] = {0};
+    uint8_t original[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    uint8_t generator_polynomial_buffer[BUFFER_SIZE] = {0};
+    uint8_t message_buffer[BUFFER_SIZE] = {0};
+    uint8_t syndromes[BUFFER_SIZE] = {0};
+    uint8_t used[BUFFER_SIZE] = {0};
+    int erasures[BUFFER_SIZE];
+    int codeword_length = message_length + generator_length - 1;
+
+    for(int i = 0; i < message_length; i++) {
+        message_buffer[i] = (uint8_t)rs_test_random(state);
+    }
+    rs_generator_polynomial(f, generator_polynomial_buffer, 
+        working_buffer, generator_length);
+    rs_encode(f, original, working_buffer, message_buffer, message_length, 
+        generator_polynomial_buffer, generator_length);
+    for(int i = 0; i < codeword_length; i++) {
+        buffer[i] = original[i];
+    }
+
+    // Erased symbols get wiped to 0 like a failed read would
+    int expected = 0;
+    for(int i = 0; i < erasure_count + errors; i++) {
+        int position;
+        do {
+            position = rs_test_random(state) % codeword_length;
+        } while(used[position]);
+        used[position] = 1;
+        if(i < erasure_count) {
+            erasures[i] = position;
+            buffer[position] = 0;
+        } else {
+            buffer[position] ^= (uint8_t)(rs_test_random(state) % 255 + 1);
+        }
+        if(buffer[position] != original[position]) {
+            expected++;
+        }
+    }
+
+    rs_calc_syndromes(f, syndromes, buffer, codeword_length, 
+        generator_length, 0);
+    int result = rs_decode_erasures(f, buffer, codeword_length, syndromes, 
+        generator_length, erasures, erasure_count, decode_buffer);
+    TEST_ASSERT_EQUAL_INT(expected, result);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(original, buffer, codeword_length);
+}
+
+void rs_decode_erasures_tests()
+{
+    uint32_t state = 11;
+
+    // Every mix of erasures and errors that fits in (255, 223)
+    for(int erasure_count = 0; erasure_count <= 32; erasure_count++) {
+        for(int errors = 0; 2 * errors + erasure_count <= 32; errors++) {
+            rs_decode_erasures_round_trip(field, 223, 33, erasure_count, 
+                errors, &state);
+        }
+    }
+
+    // Pure erasures on shortened codes, up to all of the parity
+    for(int trial = 0; trial < 8; trial++) {
+        rs_decode_erasures_round_trip(field, 16, 11, 10, 0, &state);
+        rs_decode_erasures_round_trip(field, 40, 10, 5, 2, &state);
+        rs_decode_erasures_round_trip(field, 1, 3, 2, 0, &state);
+    }
+
+    // Other fields
+    static gf8_field_t other_field;
+    TEST_ASSERT_EQUAL_INT(0, gf8_field_init(&other_field, 
+        GF8_POLYNOMIAL_AES));
+    for(int trial = 0; trial < 8; trial++) {
+        rs_decode_erasures_round_trip(&other_field, 100, 17, 6, 5, &state);
+        rs_decode_erasures_round_trip(&other_field, 100, 17, 16, 0, &state);
+    }
+}
+
+void rs_decode_erasures_invalid_tests()
+{
+    uint8_t buffer[BUFFER_SIZE] = {0};
+    uint8_t before[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    uint8_t generator_polynomial_buffer[BUFFER_SIZE] = {0};
+    uint8_t message_buffer[BUFFER_SIZE] = {0};
+    uint8_t syndromes[BUFFER_SIZE] = {0};
+
+    for(int i = 0; i < 16; i++) {
+        message_buffer[i] = (uint8_t)(i + 1);
+    }
+    rs_generator_polynomial(field, generator_polynomial_buffer, 
+        working_buffer, 11);
+    rs_encode(field, buffer, working_buffer, message_buffer, 16, 
+        generator_polynomial_buffer, 11);
+    buffer[3] = 0;
+    buffer[7] = 0;
+    for(int i = 0; i < 26; i++) {
+        before[i] = buffer[i];
+    }
+    rs_calc_syndromes(field, syndromes, buffer, 26, 11, 0);
+
+    // Out of range, too many and the same one twice
+    int out_of_range[] = { 3, 26 };
+    TEST_ASSERT_EQUAL_INT(-1, rs_decode_erasures(field, buffer, 26, 
+        syndromes, 11, out_of_range, 2, decode_buffer));
+    int too_many[11] = { 3, 7, 0, 1, 2, 4, 5, 6, 8, 9, 10 };
+    TEST_ASSERT_EQUAL_INT(-1, rs_decode_erasures(field, buffer, 26, 
+        syndromes, 11, too_many, 11, decode_buffer));
+    int repeated[] = { 3, 7, 7 };
+    TEST_ASSERT_EQUAL_INT(-1, rs_decode_erasures(field, buffer, 26, 
+        syndromes, 11, repeated, 3, decode_buffer));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(before, buffer, 26);
+
+    // Erasures that are actually fine aren't counted
+    int erasures[] = { 3, 7, 12 };
+    TEST_ASSERT_EQUAL_INT(2, rs_decode_erasures(field, buffer, 26, 
+        syndromes, 11, erasures, 3, decode_buffer));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(message_buffer, buffer, 16);
+}
+
+void rs_decode_single_error_tests()
+{
+    uint32_t state = 5;
+
+    // One bad symbol at every position of a full and a shortened code
+    int message_lengths[] = { 223, 16 };
+    int generator_lengths[] = { 33, 11 };
+    for(int c = 0; c < 2; c++) {
+        uint8_t buffer[BUFFER_SIZE] = {0};
+        uint8_t original[BUFFER_SIZE] = {0};
+        uint8_t working_buffer[BUFFER_SIZE] = {0};
+        uint8_t generator_polynomial_buffer[BUFFER_SIZE] = {0};
+        uint8_t message_buffer[BUFFER_SIZE] = {0};
+        uint8_t syndromes[BUFFER_SIZE] = {0};
+        int codeword_length = message_lengths[c] + generator_lengths[c] - 1;
+
+        for(int i = 0; i < message_lengths[c]; i++) {
+            message_buffer[i] = (uint8_t)rs_test_random(&state);
+        }
+        rs_generator_polynomial(field, generator_polynomial_buffer, 
+            working_buffer, generator_lengths[c]);
+        rs_encode(field, original, working_buffer, message_buffer, 
+            message_lengths[c], generator_polynomial_buffer, 
+            generator_lengths[c]);
+
+        for(int position = 0; position < codeword_length; position++) {
+            for(int i = 0; i < codeword_length; i++) {
+                buffer[i] = original[i];
+            }
+            buffer[position] ^= (uint8_t)(rs_test_random(&state) % 255 + 1);
+            rs_calc_syndromes(field, syndromes, buffer, codeword_length, 
+                generator_lengths[c], 0);
+            TEST_ASSERT_EQUAL_INT(1, rs_decode(field, buffer, 
+                codeword_length, syndromes, generator_lengths[c], 
+                decode_buffer));
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(original, buffer, codeword_length);
+        }
+    }
+
+    // The smallest code that can correct anything, and the AES field
+    rs_decode_round_trip(field, 1, 3, 1, &state);
+    static gf8_field_t other_field;
+    TEST_ASSERT_EQUAL_INT(0, gf8_field_init(&other_field, 
+        GF8_POLYNOMIAL_AES));
+    for(int trial = 0; trial < 16; trial++) {
+        rs_decode_round_trip(&other_field, 100, 17, 1, &state);
+    }
+}
+
+void rs_decode_single_error_outside_tests()
+{
+    uint8_t buffer[BUFFER_SIZE] = {0};
+    uint8_t syndromes[BUFFER_SIZE] = {0};
+
+    // Syndromes that look like one error at degree 100 of a 26 symbol 
+    // codeword. There's no such symbol so it has to give up.
+    for(int i = 0; i < 10; i++) {
+        syndromes[i + 1] = gf8_mul(field, 0x35, gf8_pow(field, 
+            gf8_pow(field, 2, 100), i));
+    }
+    for(int i = 0; i < 26; i++) {
+        buffer[i] = (uint8_t)i;
+    }
+    TEST_ASSERT_EQUAL_INT(-1, rs_decode(field, buffer, 26, syndromes, 11, 
+        decode_buffer));
+    for(int i = 0; i < 26; i++) {
+        TEST_ASSERT_EQUAL_HEX8(i, buffer[i]);
+    }
+}
+
+// Codeword lengths on both sides of the Chien search block boundaries
+static void rs_decode_chien_blocks_test()
+{
+    uint32_t state = 13;
+    int message_lengths[] = { 33, 34, 96, 97, 223 };
+    for(int c = 0; c < 5; c++) {
+        for(int errors = 2; errors <= 16; errors += 7) {
+            rs_decode_round_trip(field, message_lengths[c], 33, errors, 
+                &state);
+        }
+        rs_decode_erasures_round_trip(field, message_lengths[c], 33, 20, 
+            6, &state);
+    }
+}
+
+void rs_decode_chien_tests()
+{
+    // Once per region kernel, since the Chien search is built on them
+    gf8_impl_t original = gf8_region_impl();
+    for(int impl = 0; impl < GF8_IMPL_COUNT; impl++) {
+        if(gf8_region_set_impl((gf8_impl_t)impl) == 0) {
+            rs_decode_chien_blocks_test();
+        }
+    }
+    gf8_region_set_impl(original);
+}
+
+// Room for every codec tried here. How much each one actually takes is 
+// up to rs_codec_memory_size.
+static uint8_t codec_memory[128 * 1024];
+
+// Sets up a codec in codec_memory, after checking it fits
+static int rs_test_codec_init(rs_codec_t* codec, const gf8_field_t* f, 
+    int n, int k, int fcr, int prim, int slices)
+{
+    size_t size = rs_codec_memory_size(n, k, slices);
+    TEST_ASSERT_TRUE(size > 0 && size <= sizeof(codec_memory));
+    return rs_codec_init(codec, f, n, k, fcr, prim, codec_memory, slices);
+}
+
+// Corrupts a codec codeword kept as separate data and parity, with the
+// first erasure_count bad symbols wiped to 0 and listed as erasures
+static void rs_codec_round_trip(rs_codec_t* codec, int erasure_count, 
+    int errors, uint32_t* state)
+{
+    uint8_t data[BUFFER_SIZE] = {0};
+    uint8_t parity[BUFFER_SIZE] = {0};
+    uint8_t original_data[BUFFER_SIZE] = {0};
+    uint8_t original_parity[BUFFER_SIZE] = {0};
+    uint8_t used[BUFFER_SIZE] = {0};
+    int erasures[BUFFER_SIZE];
+    int k = codec->k;
+    int number_of_symbols = codec->n - codec->k;
+
+    for(int i = 0; i < k; i++) {
+        data[i] = (uint8_t)rs_test_random(state);
+    }
+    TEST_ASSERT_EQUAL_INT(0, rs_codec_encode(codec, data, parity));
+    TEST_ASSERT_EQUAL_INT(0, rs_codec_check(codec, data, parity));
+    memcpy(original_data, data, k);
+    memcpy(original_parity, parity, number_of_symbols);
+
+    int expected = 0;
+    for(int i = 0; i < erasure_count + errors; i++) {
+        int position;
+        do {
+            position = rs_test_random(state) % codec->n;
+        } while(used[position]);
+        used[position] = 1;
+        uint8_t* symbol = (position < k) ? &data[position] : 
+            &parity[position - k];
+        uint8_t before = *symbol;
+        if(i < erasure_count) {
+            erasures[i] = position;
+            *symbol = 0;
+        } else {
+            *symbol ^= (uint8_t)(rs_test_random(state) % 255 + 1);
+        }
+        if(*symbol != before) {
+            expected++;
+        }
+    }
+
+    TEST_ASSERT_EQUAL_INT(expected != 0, rs_codec_check(codec, data, parity));
+    TEST_ASSERT_EQUAL_INT(expected, rs_codec_decode_erasures(codec, data, 
+        parity, erasures, erasure_count));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(original_data, data, k);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(original_parity, parity, number_of_symbols);
+}
+
+void rs_codec_tests()
+{
+    uint32_t state = 17;
+    uint8_t expected[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    uint8_t generator_polynomial_buffer[BUFFER_SIZE] = {0};
+    uint8_t message_buffer[BUFFER_SIZE] = {0};
+    uint8_t parity[BUFFER_SIZE] = {0};
+    rs_codec_t codec;
+
+    // fcr 0 and prim 1 is the same code rs_encode makes
+    int n = 100;
+    int k = 84;
+    int generator_length = n - k + 1;
+    rs_generator_polynomial(field, generator_polynomial_buffer, 
+        working_buffer, generator_length);
+    for(int i = 0; i < k; i++) {
+        message_buffer[i] = (uint8_t)(i * 167 + 13);
+    }
+    rs_encode(field, expected, working_buffer, message_buffer, k, 
+        generator_polynomial_buffer, generator_length);
+
+    // With and without a table
+    for(int slices = 0; slices <= RS_ENCODER_MAX_SLICES; slices++) {
+        TEST_ASSERT_EQUAL_INT(0, rs_test_codec_init(&codec, field, n, k, 
+            0, 1, slices));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(generator_polynomial_buffer, 
+            codec.generator, generator_length);
+
+        memset(parity, 0, sizeof(parity));
+        TEST_ASSERT_EQUAL_INT(0, rs_codec_encode(&codec, message_buffer, 
+            parity));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected + k, parity, n - k);
+        TEST_ASSERT_EQUAL_INT(0, rs_codec_check(&codec, message_buffer, 
+            parity));
+
+        for(int errors = 0; errors <= 8; errors++) {
+            rs_codec_round_trip(&codec, 0, errors, &state);
+        }
+        rs_codec_round_trip(&codec, 16, 0, &state);
+        rs_codec_round_trip(&codec, 6, 5, &state);
+    }
+}
+
+void rs_codec_ccsds_tests()
+{
+    uint32_t state = 19;
+    static gf8_field_t ccsds_field;
+    uint8_t data[BUFFER_SIZE] = {0};
+    uint8_t codeword[BUFFER_SIZE] = {0};
+    rs_codec_t codec;
+
+    // CCSDS (255, 223) has its roots at alpha^(11 * (112 + i))
+    TEST_ASSERT_EQUAL_INT(0, gf8_field_init(&ccsds_field, 
+        GF8_POLYNOMIAL_CCSDS));
+    TEST_ASSERT_EQUAL_INT(0, rs_test_codec_init(&codec, &ccsds_field, 
+        255, 223, 112, 11, 4));
+
+    // Every root has to be a root of the codeword too
+    for(int i = 0; i < 223; i++) {
+        data[i] = (uint8_t)rs_test_random(&state);
+    }
+    memcpy(codeword, data, 223);
+    rs_codec_encode(&codec, data, codeword + 223);
+    for(int i = 0; i < 32; i++) {
+        uint8_t root = gf8_pow(&ccsds_field, ccsds_field.generator, 
+            (11 * (112 + i)) % 255);
+        TEST_ASSERT_EQUAL_HEX8(root, codec.roots[i]);
+        TEST_ASSERT_EQUAL_HEX8(0, gf8_poly_eval(&ccsds_field, codeword, 
+            root, 255));
+    }
+
+    for(int errors = 0; errors <= 16; errors++) {
+        rs_codec_round_trip(&codec, 0, errors, &state);
+    }
+    rs_codec_round_trip(&codec, 32, 0, &state);
+    rs_codec_round_trip(&codec, 10, 11, &state);
+
+    // Shortened too
+    TEST_ASSERT_EQUAL_INT(0, rs_test_codec_init(&codec, &ccsds_field, 
+        60, 28, 112, 11, 0));
+    for(int errors = 0; errors <= 16; errors++) {
+        rs_codec_round_trip(&codec, 0, errors, &state);
+    }
+    rs_codec_round_trip(&codec, 20, 6, &state);
+}
+
+void rs_shortened_tests()
+{
+    uint32_t state = 31;
+    uint8_t record[BUFFER_SIZE];
+    uint8_t codeword[BUFFER_SIZE] = {0};
+    uint8_t full[BUFFER_SIZE] = {0};
+    uint8_t working_buffer[BUFFER_SIZE] = {0};
+    uint8_t generator_polynomial_buffer[BUFFER_SIZE] = {0};
+    uint8_t syndromes[BUFFER_SIZE] = {0};
+    uint8_t full_syndromes[BUFFER_SIZE] = {0};
+    uint8_t parity[BUFFER_SIZE] = {0};
+    rs_codec_t codec;
+
+    // A 40 + 8 record with junk right after it that mustn't get read
+    int k = 40;
+    int generator_length = 9;
+    int n = k + generator_length - 1;
+    memset(record, 0xEE, sizeof(record));
+    for(int i = 0; i < k; i++) {
+        record[i] = (uint8_t)rs_test_random(&state);
+    }
+    rs_generator_polynomial(field, generator_polynomial_buffer, 
+        working_buffer, generator_length);
+    TEST_ASSERT_EQUAL_INT(0, rs_encode(field, codeword, working_buffer, 
+        record, k, generator_polynomial_buffer, generator_length));
+
+    // It's the full length code with zeroes in front
+    int padding = 255 - n;
+    memcpy(full + padding, record, k);
+    TEST_ASSERT_EQUAL_INT(0, rs_encode(field, full, working_buffer, 
+        full, 255 - (generator_length - 1), generator_polynomial_buffer, 
+        generator_length));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(full + padding, codeword, n);
+
+    // Same for the syndromes once both have the same errors
+    rs_test_corrupt(codeword, n, 4, &state);
+    memcpy(full + padding, codeword, n);
+    rs_calc_syndromes(field, syndromes, codeword, n, generator_length, 0);
+    rs_calc_syndromes(field, full_syndromes, full, 255, generator_length, 0);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(full_syndromes, syndromes, 
+        generator_length);
+
+    // Decoding only looks at the 48 bytes
+    TEST_ASSERT_EQUAL_INT(4, rs_decode(field, codeword, n, syndromes, 
+        generator_length, decode_buffer));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(record, codeword, k);
+
+    // And a codec for the shortened code gives the same parity
+    TEST_ASSERT_EQUAL_INT(0, rs_test_codec_init(&codec, field, n, k, 
+        0, 1, 4));
+    rs_codec_encode(&codec, record, parity);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(codeword + k, parity, n - k);
+    for(int errors = 0; errors <= 4; errors++) {
+        rs_codec_round_trip(&codec, 0, errors, &state);
+    }
+}
+
+void rs_update_parity_tests()
+{
+    uint32_t state = 29;
+    static gf8_field_t ccsds_field;
+    uint8_t data[BUFFER_SIZE] = {0};
+    uint8_t parity[BUFFER_SIZE] = {0};
+    uint8_t expected[BUFFER_SIZE] = {0};
+    uint8_t written[BUFFER_SIZE] = {0};
+    uint8_t old_bytes[BUFFER_SIZE] = {0};
+    rs_codec_t codec;
+
+    TEST_ASSERT_EQUAL_INT(0, gf8_field_init(&ccsds_field, 
+        GF8_POLYNOMIAL_CCSDS));
+    for(int c = 0; c < 2; c++) {
+        if(c == 0) {
+            rs_test_codec_init(&codec, field, 255, 223, 0, 1, 8);
+        } else {
+            rs_test_codec_init(&codec, &ccsds_field, 60, 28, 112, 11, 0);
+        }
+        int k = codec.k;
+        for(int i = 0; i < k; i++) {
+            data[i] = (uint8_t)rs_test_random(&state);
+        }
+        rs_codec_encode(&codec, data, parity);
+
+        // Writes of all sizes all over the data, one of them the whole 
+        // thing, each checked against encoding from scratch
+        for(int w = 0; w < 50; w++) {
+            int length = (w == 0) ? k : 
+                1 + (int)(rs_test_random(&state) % 20);
+            int offset = rs_test_random(&state) % (k - length + 1);
+            for(int i = 0; i < length; i++) {
+                written[i] = (uint8_t)rs_test_random(&state);
+            }
+            memcpy(old_bytes, data + offset, length);
+            memcpy(data + offset, written, length);
+            TEST_ASSERT_EQUAL_INT(0, rs_update_parity(&codec, parity, 
+                offset, old_bytes, written, length));
+
+            rs_codec_encode(&codec, data, expected);
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, parity, codec.n - k);
+        }
+
+        // Past the end of the data
+        TEST_ASSERT_EQUAL_INT(-1, rs_update_parity(&codec, parity, 
+            k - 1, old_bytes, written, 2));
+        TEST_ASSERT_EQUAL_INT(-1, rs_update_parity(&codec, parity, 
+            -1, old_bytes, written, 1));
+    }
+}
+
+void rs_codec_invalid_tests()
+{
+    rs_codec_t codec;
+    TEST_ASSERT_EQUAL_INT(-1, rs_codec_init(&codec, field, 10, 0, 0, 1, 
+        codec_memory, 1));
+    TEST_ASSERT_EQUAL_INT(-1, rs_codec_init(&codec, field, 10, 10, 0, 1, 
+        codec_memory, 1));
+    TEST_ASSERT_EQUAL_INT(-1, rs_codec_init(&codec, field, 256, 200, 0, 1, 
+        codec_memory, 1));
+    TEST_ASSERT_EQUAL_INT(-1, rs_codec_init(&codec, field, 255, 223, 255, 1, 
+        codec_memory, 1));
+    // 5 divides 255 so the roots would repeat
+    TEST_ASSERT_EQUAL_INT(-1, rs_codec_init(&codec, field, 255, 223, 0, 5, 
+        codec_memory, 1));
+    TEST_ASSERT_EQUAL_INT(-1, rs_codec_init(&codec, field, 255, 223, 0, 0, 
+        codec_memory, 1));
+    // Slices have to fit in the parity
+    TEST_ASSERT_EQUAL_INT(-1, rs_codec_init(&codec, field, 12, 10, 0, 1, 
+        codec_memory, 3));
+    TEST_ASSERT_EQUAL_INT(-1, rs_codec_init(&codec, field, 255, 223, 0, 1, 
+        codec_memory, RS_ENCODER_MAX_SLICES + 1));
+    TEST_ASSERT_EQUAL_INT(0, (int)rs_codec_memory_size(10, 10, 1));
+}
@@ -5,10 +5,31 @@ void rs_generator_polynomial_tests();
 
 void rs_encode_tests();
 void rs_encode_tests_2();
+void rs_encoder_tests();
+void rs_parity_matrix_tests();
 
 void rs_calc_syndromes_tests();
 void rs_calc_syndromes_tests_2();
+void rs_encode_parity_tests();
+void rs_encoder_state_tests();
+void rs_calc_syndromes_matrix_tests();
 
 void rs_check_if_error_tests();
 
+void rs_decode_tests();
+void rs_decode_too_many_errors_tests();
+void rs_decode_other_field_tests();
+void rs_decode_erasures_tests();
+void rs_decode_erasures_invalid_tests();
+void rs_decode_single_error_tests();
+void rs_decode_single_error_outside_tests();
+void rs_decode_chien_tests();
+void rs_codec_tests();
+void rs_codec_ccsds_tests();
+void rs_shortened_tests();
+void rs_update_parity_tests();
+void rs_codec_invalid_tests();
+
+void rs_other_field_tests();
+
 #endif
\ No newline at end of file
@@ -1,7 +1,12 @@
 #include "unity/unity.h"
 #include "galois_field_8_tests.h"
 #include "galois_field_8_poly_tests.h"
+#include "galois_field_8_region_tests.h"
 #include "rs_ec_tests.h"
+#include "rs_bitslice_tests.h"
+#include "galois_field_16_tests.h"
+#include "rs_ec_16_tests.h"
+#include "ecc_buffers_tests.h"
 
 int main()
 {
@@ -22,6 +27,9 @@ int main()
     RUN_TEST(gf8_inv_tests);
     RUN_TEST(gf8_pow_tests);
 
+    RUN_TEST(gf8_tables_tests);
+    RUN_TEST(gf8_field_init_tests);
+
 
     // Unit tests on galois polynomials
     ////
@@ -39,16 +47,98 @@ int main()
     RUN_TEST(gf8_poly_eval_tests);
 
 
+    // Unit tests on galois region operations
+    ////
+    RUN_TEST(gf8_region_mul_tests);
+    RUN_TEST(gf8_region_mul_xor_tests);
+    RUN_TEST(gf8_region_mul_inplace_tests);
+    RUN_TEST(gf8_region_dot_tests);
+    RUN_TEST(gf8_region_syndromes_tests);
+    RUN_TEST(gf8_region_eval_tests);
+    RUN_TEST(gf8_region_dispatch_tests);
+    RUN_TEST(gf8_region_other_field_tests);
+
+
     // RS Error Correction tests
     ////    
     RUN_TEST(rs_generator_polynomial_tests);
     RUN_TEST(rs_encode_tests);
     RUN_TEST(rs_encode_tests_2);
+    RUN_TEST(rs_encoder_tests);
+    RUN_TEST(rs_parity_matrix_tests);
 
     RUN_TEST(rs_calc_syndromes_tests);
     RUN_TEST(rs_calc_syndromes_tests_2);
+    RUN_TEST(rs_encode_parity_tests);
+    RUN_TEST(rs_encoder_state_tests);
+    RUN_TEST(rs_calc_syndromes_matrix_tests);
     RUN_TEST(rs_check_if_error_tests);
 
+    RUN_TEST(rs_decode_tests);
+    RUN_TEST(rs_decode_too_many_errors_tests);
+    RUN_TEST(rs_decode_other_field_tests);
+    RUN_TEST(rs_decode_erasures_tests);
+    RUN_TEST(rs_decode_erasures_invalid_tests);
+    RUN_TEST(rs_decode_single_error_tests);
+    RUN_TEST(rs_decode_single_error_outside_tests);
+    RUN_TEST(rs_decode_chien_tests);
+    RUN_TEST(rs_codec_tests);
+    RUN_TEST(rs_codec_ccsds_tests);
+    RUN_TEST(rs_shortened_tests);
+    RUN_TEST(rs_update_parity_tests);
+    RUN_TEST(rs_codec_invalid_tests);
+
+    RUN_TEST(rs_other_field_tests);
+
+
+    // Bitsliced RS tests
+    ////
+    RUN_TEST(rs_bitslice_transpose_tests);
+    RUN_TEST(rs_bitslice_encode_tests);
+    RUN_TEST(rs_bitslice_calc_syndromes_tests);
+    RUN_TEST(rs_bitslice_other_field_tests);
+    RUN_TEST(rs_decode_batch_tests);
+    RUN_TEST(rs_decode_batch_random_tests);
+    RUN_TEST(rs_decode_batch_other_field_tests);
+
+
+    // Protected buffer tests
+    ////
+    RUN_TEST(ecc_buffer_init_tests);
+    RUN_TEST(ecc_buffer_round_trip_tests);
+    RUN_TEST(ecc_buffer_correct_tests);
+    RUN_TEST(ecc_buffer_lazy_verify_tests);
+    RUN_TEST(ecc_buffer_uncorrectable_tests);
+    RUN_TEST(ecc_buffer_scrub_tests);
+    RUN_TEST(ecc_buffer_scrubber_tests);
+    RUN_TEST(ecc_buffer_write_back_tests);
+    RUN_TEST(ecc_buffer_write_back_age_tests);
+    RUN_TEST(ecc_buffer_write_back_stop_tests);
+    RUN_TEST(ecc_buffer_view_tests);
+
+
+    // Unit tests on GF(2^16) operations
+    ////
+    RUN_TEST(gf16_field_init_tests);
+
+    RUN_TEST(gf16_mul_tests);
+    RUN_TEST(gf16_mul_lut_tests);
+    RUN_TEST(gf16_muldiv_exhaustive_tests);
+
+    RUN_TEST(gf16_inv_tests);
+    RUN_TEST(gf16_pow_tests);
+
+    RUN_TEST(gf16_poly_tests);
+    RUN_TEST(gf16_region_mul_xor_tests);
+
+
+    // GF(2^16) RS Error Correction tests
+    ////
+    RUN_TEST(rs16_generator_polynomial_tests);
+    RUN_TEST(rs16_encode_tests);
+    RUN_TEST(rs16_encode_long_tests);
+    RUN_TEST(rs16_calc_syndromes_tests);
+
 
     return UNITY_END();
 }
\ No newline at end of file
@@ -0,0 +1,82 @@
+/*
+ * Generates galois_field_8_tables.c, the read only default (0x11D) 
+ * field. Run it through the gf8-tables CMake target whenever the field 
+ * or the table layout changes:
+ *
+ *      cmake --build build --target gf8-tables
+ */
+
+#include <stdio.h>
+#include "../galois_field_8.h"
+
+static void print_bytes(FILE* out, const char* name,
+    const uint8_t* values, int count)
+{
+    fprintf(out, "    .%s = {", name);
+    for(int i = 0; i < count; i++) {
+        fprintf(out, "%s0x%02X%s", (i % 12 == 0) ? "\n        " : " ",
+            values[i], (i + 1 < count) ? "," : "");
+    }
+    fprintf(out, "\n    },\n");
+}
+
+static void print_nibble_table(FILE* out, const char* name,
+    const uint8_t table[256][16])
+{
+    fprintf(out, "    .%s = {\n", name);
+    for(int c = 0; c <= 0xFF; c++) {
+        fprintf(out, "        {");
+        for(int i = 0; i < 16; i++) {
+            fprintf(out, "0x%02X%s", table[c][i], (i < 15) ? "," : "");
+        }
+        fprintf(out, "}%s\n", (c < 0xFF) ? "," : "");
+    }
+    fprintf(out, "    },\n");
+}
+
+int main(int argc, char** argv)
+{
+    gf8_field_t field;
+    if(gf8_field_init(&field, GF8_POLYNOMIAL_DEFAULT) != 0) {
+        fprintf(stderr, "failed to build the default field\n");
+        return 1;
+    }
+
+    FILE* out = stdout;
+    if(argc > 1) {
+        out = fopen(argv[1], "w");
+        if(out == NULL) {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    fprintf(out, "// Generated by tools/gf8_table_gen.c, do not edit.\n");
+    fprintf(out, "// Regenerate with the gf8-tables target.\n\n");
+    fprintf(out, "#include \"galois_field_8.h\"\n\n");
+    fprintf(out, "const gf8_field_t gf8_field_default = {\n");
+    fprintf(out, "    .polynomial = 0x%03X,\n", field.polynomial);
+    fprintf(out, "    .generator = 0x%02X,\n", field.generator);
+
+    print_bytes(out, "exp", field.exp, GF8_EXP_TABLE_SIZE);
+    print_bytes(out, "log", field.log, GF8_LOG_TABLE_SIZE);
+    print_nibble_table(out, "mul_lo", field.mul_lo);
+    print_nibble_table(out, "mul_hi", field.mul_hi);
+
+    fprintf(out, "    .affine = {");
+    for(int c = 0; c <= 0xFF; c++) {
+        fprintf(out, "%s0x%016llXULL%s", (c % 3 == 0) ? "\n        " : " ",
+            (unsigned long long)field.affine[c], (c < 0xFF) ? "," : "");
+    }
+    fprintf(out, "\n    },\n");
+
+    print_bytes(out, "to_aes", field.to_aes, 256);
+    fprintf(out, "    .from_aes_affine = 0x%016llXULL\n",
+        (unsigned long long)field.from_aes_affine);
+    fprintf(out, "};\n");
+
+    if(out != stdout) {
+        fclose(out);
+    }
+    return 0;
+}